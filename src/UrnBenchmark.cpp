@@ -0,0 +1,425 @@
+//UrnBenchmark.cpp, October 16, 2026
+//
+//Benchmark of the urn models and GenericUrn for several shapes and access patterns.
+//Every benchmark repeats passes over the draws until the minimum time has elapsed.
+//The results are written as JSON to the standard output or the output file and as a table to the standard error.
+//Usage: UrnBenchmark [--min-time SECONDS] [--filter TEXT] [--output FILE]
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <functional>
+#include <stdexcept>
+#include <cstddef>
+#include "urn.hpp"
+
+using namespace urn;
+
+//Allocation counter, every replaceable allocation function of the global operator new is counted.
+
+namespace
+{
+    std::atomic<std::size_t> allocations {};
+
+    void* allocate(std::size_t size, std::size_t alignment) noexcept
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        size = size == 0 ? 1 : size;
+        if(alignment <= alignof(std::max_align_t))
+        {
+            return std::malloc(size);
+        }
+        //aligned_alloc requires a size which is a multiple of the alignment.
+        return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    }
+
+    void* allocateOrThrow(std::size_t size, std::size_t alignment)
+    {
+        if(void* memory {allocate(size, alignment)})
+        {
+            return memory;
+        }
+        throw std::bad_alloc();
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    return allocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+//All deallocation functions forward to operator delete(void*), because malloc and aligned_alloc are both released with free.
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    operator delete(memory);
+}
+
+namespace
+{
+    constexpr std::size_t passSize {1 << 16};   //Largest number of draws of a pass.
+    constexpr std::size_t batchSize {4096};     //Number of draws of a fill() call.
+
+    volatile std::size_t sink {};               //Receives a value of every draw, so that no draw is optimized away.
+
+    /*
+     * Result of a benchmark.
+     */
+    struct Result
+    {
+        std::string model;
+        uint n {};
+        uint k {};
+        std::string pattern;
+        std::size_t draws {};
+        double seconds {};
+        std::size_t allocations {};
+    };
+
+    /*
+     * Options of the command line.
+     */
+    struct Options
+    {
+        double minTime {0.2};
+        std::string filter {};
+        std::string output {};
+    };
+
+    std::size_t weight(const uint& ball)
+    {
+        return ball;
+    }
+
+    std::size_t weight(const std::string& element)
+    {
+        return element.size();
+    }
+
+    /*
+     * Runs pass, which returns the number of draws it has visited, until options.minTime has elapsed.
+     */
+    void measure(std::vector<Result>& results, const Options& options, const std::string& model, uint n, uint k, const std::string& pattern, const std::function<std::size_t()>& pass)
+    {
+        const std::string name {model + "{" + std::to_string(n) + "," + std::to_string(k) + "}/" + pattern};
+        if(name.find(options.filter) == std::string::npos)
+        {
+            return;
+        }
+        pass();
+        Result result {model, n, k, pattern};
+        const std::size_t allocationsBefore {allocations.load()};
+        const auto start {std::chrono::steady_clock::now()};
+        do
+        {
+            result.draws += pass();
+            result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        } while(result.seconds < options.minTime);
+        result.allocations = allocations.load() - allocationsBefore;
+        std::cerr << std::left << std::setw(44) << name << std::right << std::setw(12) << std::fixed << std::setprecision(1)
+                  << result.seconds * 1e9 / static_cast<double>(result.draws) << " ns/draw"
+                  << std::setw(10) << std::setprecision(2) << static_cast<double>(result.allocations) / static_cast<double>(result.draws) << " allocations/draw\n";
+        results.push_back(result);
+    }
+
+    /*
+     * Benchmarks the access patterns of an urn model or a GenericUrn.
+     */
+    template<class URN, class VALUE>
+    void benchmark(std::vector<Result>& results, const Options& options, const std::string& model, URN& urn)
+    {
+        const uint n {urn.n()};
+        const uint k {urn.k()};
+        const std::size_t count {static_cast<std::size_t>(std::min(urn.z(), static_cast<Ordinal>(passSize)))};
+
+        measure(results, options, model, n, k, "iterate", [&]()
+        {
+            auto it {urn.begin()};
+            for(std::size_t drawCount {}; drawCount < count; ++drawCount, ++it)
+            {
+                sink = sink + weight((*it)[0]);
+            }
+            return count;
+        });
+
+        measure(results, options, model, n, k, "reverse", [&]()
+        {
+            auto it {urn.rbegin()};
+            for(std::size_t drawCount {}; drawCount < count; ++drawCount, ++it)
+            {
+                sink = sink + weight((*it)[0]);
+            }
+            return count;
+        });
+
+        CounterRng rng {1};
+        std::vector<Ordinal> ordinals(batchSize);
+        for(Ordinal& ordinal: ordinals)
+        {
+            ordinal = uniformOrdinal(rng, urn.z());
+        }
+        measure(results, options, model, n, k, "random", [&]()
+        {
+            for(const Ordinal& ordinal: ordinals)
+            {
+                sink = sink + weight(urn.draw(ordinal)[0]);
+            }
+            return ordinals.size();
+        });
+
+        measure(results, options, model, n, k, "nextDraw", [&]()
+        {
+            auto draw {urn.firstDraw()};
+            for(std::size_t drawCount {1}; drawCount < count; ++drawCount)
+            {
+                draw = urn.nextDraw(draw);
+                sink = sink + weight(draw[0]);
+            }
+            return count;
+        });
+
+        std::vector<VALUE> buffer(batchSize * k);
+        measure(results, options, model, n, k, "fill", [&]()
+        {
+            for(std::size_t first {}; first < count; first += batchSize)
+            {
+                const std::size_t batch {std::min(batchSize, count - first)};
+                urn.fill(first, batch, buffer);
+                sink = sink + weight(buffer[0]);
+            }
+            return count;
+        });
+    }
+
+    void printUsage()
+    {
+        std::cerr << "Usage: UrnBenchmark [--min-time SECONDS] [--filter TEXT] [--output FILE]\n";
+    }
+
+    double toSeconds(const std::string& text)
+    {
+        std::size_t length {};
+        double seconds {};
+        try
+        {
+            seconds = std::stod(text, &length);
+        }
+        catch(const std::exception&)
+        {
+            length = 0;
+        }
+        if(length == 0 || length != text.size() || !(seconds >= 0))
+        {
+            throw std::invalid_argument("The minimum time " + text + " is not a number of seconds.");
+        }
+        return seconds;
+    }
+
+    Options parseOptions(int argc, char* argv[])
+    {
+        Options options {};
+        for(int argCount {1}; argCount < argc; argCount += 2)
+        {
+            const std::string option {argv[argCount]};
+            if(argCount + 1 >= argc)
+            {
+                throw std::invalid_argument("The option " + option + " is unknown or has no value.");
+            }
+            if(option == "--min-time")
+            {
+                options.minTime = toSeconds(argv[argCount + 1]);
+            }
+            else if(option == "--filter")
+            {
+                options.filter = argv[argCount + 1];
+            }
+            else if(option == "--output")
+            {
+                options.output = argv[argCount + 1];
+            }
+            else
+            {
+                throw std::invalid_argument("The option " + option + " is unknown.");
+            }
+        }
+        return options;
+    }
+
+    void writeJson(const std::vector<Result>& results, const std::string& output)
+    {
+        std::ostringstream json {};
+        json << std::setprecision(6) << "{\n  \"benchmarks\": [\n";
+        for(std::size_t resultCount {}; resultCount < results.size(); ++resultCount)
+        {
+            const Result& result {results[resultCount]};
+            const double draws {static_cast<double>(result.draws)};
+            json << "    {\"model\": \"" << result.model << "\", \"n\": " << result.n << ", \"k\": " << result.k
+                 << ", \"pattern\": \"" << result.pattern << "\", \"draws\": " << result.draws
+                 << ", \"seconds\": " << result.seconds
+                 << ", \"drawsPerSecond\": " << draws / result.seconds
+                 << ", \"nsPerDraw\": " << result.seconds * 1e9 / draws
+                 << ", \"allocationsPerDraw\": " << static_cast<double>(result.allocations) / draws << "}"
+                 << (resultCount + 1 < results.size() ? ",\n" : "\n");
+        }
+        json << "  ]\n}\n";
+        if(output.empty())
+        {
+            std::cout << json.str();
+            return;
+        }
+        std::ofstream file {output};
+        file << json.str();
+        if(!file.flush())
+        {
+            throw std::runtime_error("The results could not be written to " + output + ".");
+        }
+        std::cerr << "The results have been written to " << output << ".\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Options options {};
+    try
+    {
+        options = parseOptions(argc, argv);
+    }
+    catch(const std::invalid_argument& exception)
+    {
+        std::cerr << "UrnBenchmark: " << exception.what() << '\n';
+        printUsage();
+        return 1;
+    }
+    std::vector<Result> results {};
+
+    UrnOR orSmall {10,6};
+    UrnOR orBinary {2,24};
+    UrnO oSmall {10,6};
+    UrnO oWide {40,4};
+    UrnR rSmall {10,6};
+    UrnR rWide {30,5};
+    Urn lotto {49,6};
+    Urn half {30,15};
+    benchmark<UrnOR, uint>(results, options, "UrnOR", orSmall);
+    benchmark<UrnOR, uint>(results, options, "UrnOR", orBinary);
+    benchmark<UrnO, uint>(results, options, "UrnO", oSmall);
+    benchmark<UrnO, uint>(results, options, "UrnO", oWide);
+    benchmark<UrnR, uint>(results, options, "UrnR", rSmall);
+    benchmark<UrnR, uint>(results, options, "UrnR", rWide);
+    benchmark<Urn, uint>(results, options, "Urn", lotto);
+    benchmark<Urn, uint>(results, options, "Urn", half);
+
+    const std::vector<std::string> colors {"Red", "Green", "Blue", "Black", "White", "Yellow", "Orange", "Purple"};
+    GenericUrn<std::string,true,false> genericO {4, colors};
+    GenericUrn<std::string,false,false> generic {4, colors};
+    benchmark<GenericUrn<std::string,true,false>, std::string>(results, options, "GenericUrn<string,true,false>", genericO);
+    benchmark<GenericUrn<std::string,false,false>, std::string>(results, options, "GenericUrn<string,false,false>", generic);
+
+    try
+    {
+        writeJson(results, options.output);
+    }
+    catch(const std::exception& exception)
+    {
+        std::cerr << "UrnBenchmark: " << exception.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
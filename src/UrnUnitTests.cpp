@@ -3,8 +3,19 @@
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch.hpp>
 #include "urn.hpp"
+#include "parallel.hpp"
+#include "format.hpp"
+#include "drawfile.hpp"
+#include "cli.hpp"
+#include <filesystem>
+#include <fstream>
 #include <string>
 #include <concepts>
+#include <numeric>
+#include <set>
+#include <atomic>
+#include <ranges>
+#include <unistd.h>
 using namespace urn;
 
 template<class T>
@@ -56,6 +67,44 @@ std::string iterateRange(auto IteratorBegin, auto IteratorEnd)
     return draws;
 }
 
+//Function for minimal change test, checks all draws, the number of changed positions and the reported changes
+bool enumerateMinimalChange(const UrnOR& u)
+{
+    MinimalChange mc {u};
+    std::set<Draw> draws {};
+    Draw previous {};
+    while(mc.valid())
+    {
+        if(!draws.empty())
+        {
+            uint changed {};
+            for(uint posCount {}; posCount < u.k(); ++posCount)
+            {
+                changed += (previous[posCount] != mc.draw()[posCount]);
+            }
+            for(const auto& change: mc.changes())
+            {
+                if(previous[change.position] != change.oldBall)
+                {
+                    return false;
+                }
+                previous[change.position] = change.newBall;
+            }
+            if(changed == 0 || changed > 2 || previous != mc.draw())
+            {
+                return false;
+            }
+        }
+        if(u.rank(mc.draw()) >= u.z() || !draws.insert(mc.draw()).second)
+        {
+            return false;
+        }
+        previous = mc.draw();
+        mc.next();
+    }
+    return draws.size() == u.z() && mc.changes().empty();
+}
+
 //Test ADT for GenericUrn
 namespace per
 {
@@ -218,6 +267,205 @@ TEST_CASE("UrnOR")
         auto iter = 3 + u.begin();
         REQUIRE(to_string(*iter) == "1 1");
     }
+
+    //Test for large counts
+    SECTION("6")
+    {
+        REQUIRE(UrnOR{10,19}.z() == 10000000000000000000ULL);
+        REQUIRE(to_string(UrnOR{10,12}.draw(987654321098)) == "9 8 7 6 5 4 3 2 1 0 9 8");
+        REQUIRE_THROWS_AS((UrnOR{2,128}.z()),std::overflow_error);
+        REQUIRE_THROWS_WITH((UrnOR{2,128}.z()),"The number of draws exceeds the range of the ordinal type.");
+    }
+
+    //Test for random access
+    SECTION("7")
+    {
+        UrnOR u {1,3};
+        REQUIRE(u.z() == 1);
+        REQUIRE(to_string(u.draw(0)) == "0 0 0");
+        REQUIRE(to_string(UrnOR{2,63}.draw(1)) == "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1");
+
+        UrnOR w {10,18};
+        auto it {w.begin() + 123456789012345678};
+        REQUIRE(to_string(*it) == "1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8");
+        it -= 123456789012345678;
+        REQUIRE((*it) == w.draw(0));
+        REQUIRE(w.end() - it == 1000000000000000000);
+        REQUIRE(std::lower_bound(w.begin(), w.end(), Draw{9,9,9,0}) - w.begin() == 999000000000000000);
+        REQUIRE(std::distance(w.begin(), w.end()) == 1000000000000000000);
+        REQUIRE(std::ranges::lower_bound(w, Draw{9,9,9,0}) - w.begin() == 999000000000000000);
+
+        UrnOR v {4,5};
+        Draw current {v.firstDraw()};
+        for(Ordinal ordinalCount {1}; ordinalCount < v.z(); ++ordinalCount)
+        {
+            current = v.nextDraw(current);
+            REQUIRE(v.draw(ordinalCount) == current);
+        }
+    }
+
+    //Test for rank
+    SECTION("8")
+    {
+        UrnOR u {4,5};
+        for(Ordinal ordinalCount {}; ordinalCount < u.z(); ++ordinalCount)
+        {
+            REQUIRE(u.rank(u.draw(ordinalCount)) == ordinalCount);
+        }
+        REQUIRE(UrnOR{10,12}.rank(UrnOR{10,12}.draw(987654321098)) == 987654321098);
+        REQUIRE((*u.begin(u.draw(7))) == u.draw(7));
+        REQUIRE(u.end()-u.begin(u.draw(7)) == 1017);
+
+        REQUIRE_THROWS_AS((u.rank(Draw{0,1,2,3,4})),std::domain_error);
+        REQUIRE_THROWS_WITH((u.rank(Draw{0,1,2,3,4})),"There is no valid ordinalnumber for this draw.");
+        REQUIRE_THROWS_AS((u.rank(Draw{0})),std::domain_error);
+    }
+
+    //Test for incremental iteration
+    SECTION("9")
+    {
+        UrnOR u {4,3};
+        Ordinal ordinalCount {};
+        for(auto it {u.begin()}; it != u.end(); ++it, ++ordinalCount)
+        {
+            REQUIRE((*it) == u.draw(ordinalCount));
+        }
+        REQUIRE(ordinalCount == u.z());
+        for(auto it {u.rbegin()}; it != u.rend(); ++it)
+        {
+            REQUIRE((*it) == u.draw(--ordinalCount));
+        }
+
+        auto it {u.begin()};
+        const Draw current {*it};
+        it += 5;
+        REQUIRE((*it) == u.draw(5));
+        REQUIRE(it[-2] == u.draw(3));
+
+        //Every call of operator[] returns its own draw.
+        REQUIRE(it[1] != it[5]);
+        REQUIRE((it[1] == u.draw(6) && it[5] == u.draw(10)));
+        auto rit {u.rbegin()};
+        REQUIRE(rit[1] != rit[5]);
+        REQUIRE((rit[1] == u.draw(u.z() - 2) && rit[5] == u.draw(u.z() - 6)));
+
+        --it;
+        REQUIRE((*it) == u.draw(4));
+        REQUIRE(current == u.draw(0));
+        it += -3;
+        REQUIRE((*it) == u.draw(1));
+        REQUIRE(it.ordinalnumber() == 1);
+    }
+
+    //Test for fill
+    SECTION("10")
+    {
+        UrnOR u {3,2};
+        std::vector<uint> rows(8);
+        u.fill(2, 4, rows);
+        REQUIRE(to_string(rows) == "0 2 1 0 1 1 1 2");
+        std::vector<uint> columns(8);
+        u.fill(2, 4, columns, Layout::columnMajor);
+        REQUIRE(to_string(columns) == "0 1 1 1 2 0 1 2");
+        u.fill(0, 0, std::span<uint>{});
+        REQUIRE_THROWS_AS((u.fill(6, 4, rows)),std::domain_error);
+        REQUIRE_THROWS_AS((u.fill(0, 5, rows)),std::length_error);
+    }
+
+    //Test for the C++20 iterator concepts, const ranges and the end sentinel
+    SECTION("11")
+    {
+        REQUIRE(std::same_as<UrnOR::Iterator::iterator_concept,std::random_access_iterator_tag>);
+        REQUIRE(std::same_as<UrnOR::Iterator::iterator_category,std::random_access_iterator_tag>);
+        REQUIRE(std::sized_sentinel_for<std::default_sentinel_t,UrnOR::Iterator>);
+        REQUIRE(RandomAccessRange<const UrnOR>);
+        REQUIRE(RandomAccessRange<const UrnO>);
+        REQUIRE(std::ranges::sized_range<const Urn>);
+        REQUIRE(std::ranges::common_range<const UrnR>);
+        REQUIRE(std::random_access_iterator<ReverseIterator<UrnOR::Iterator>>);
+
+        const UrnOR u {3,4};
+        REQUIRE(std::ranges::count_if(u, [](const Draw& draw){ return draw[0] == 2; }) == 27);
+        std::ranges::subrange tail {u.begin() + 75, std::default_sentinel};
+        REQUIRE(tail.size() == 6);
+        REQUIRE(to_string(*std::ranges::next(tail.begin(), 5)) == "2 2 2 2");
+        auto it {u.begin() + 80};
+        REQUIRE(it != std::default_sentinel);
+        REQUIRE(++it == std::default_sentinel);
+        REQUIRE(std::default_sentinel - u.begin() == 81);
+        REQUIRE(u.begin() - std::default_sentinel == -81);
+        REQUIRE(to_string(*u.rbegin()) == "2 2 2 2");
+
+        //The draws are returned by value, so std::reverse_iterator does not refer to a destroyed temporary.
+        REQUIRE(std::same_as<std::iter_reference_t<UrnOR::Iterator>,Draw>);
+        std::vector<Draw> reversed {};
+        for(const Draw& draw: std::views::reverse(u))
+        {
+            reversed.push_back(draw);
+        }
+        REQUIRE(reversed.size() == 81);
+        for(Ordinal ordinal {}; ordinal < 81; ++ordinal)
+        {
+            REQUIRE(reversed[80 - ordinal] == u.draw(ordinal));
+        }
+    }
+
+    //Test for shard
+    SECTION("12")
+    {
+        const UrnOR u {3,4};
+        Ordinal next {};
+        for(Ordinal i {}; i < 7; ++i)
+        {
+            auto shard {u.shard(i, 7)};
+            REQUIRE(shard.begin().ordinalnumber() == static_cast<SignedOrdinal>(next));
+            REQUIRE(shard.size() == (i < 4 ? 12 : 11));
+            for(const Draw& draw: shard)
+            {
+                REQUIRE(u.rank(draw) == next++);
+            }
+        }
+        REQUIRE(next == u.z());
+        REQUIRE(to_string(*u.shard(6, 7).begin()) == "2 1 2 1");
+        REQUIRE(u.shard(81, 100).empty());
+        REQUIRE(u.shard(80, 100).size() == 1);
+        REQUIRE(u.shard(0, 1).size() == 81);
+        REQUIRE(shardBegin(maxOrdinal, 1, 2) == maxOrdinal / 2 + 1);
+        REQUIRE_THROWS_AS((u.shard(3, 3)),std::domain_error);
+        REQUIRE_THROWS_AS((u.shard(0, 0)),std::domain_error);
+    }
+
+    //Test for Cursor
+    SECTION("13")
+    {
+        const UrnOR u {3,4};
+        auto it {u.begin() + 70};
+        const Cursor cursor {it.cursor()};
+        REQUIRE(cursor.toText() == "UrnOR 3 4 70 2 1 2 1");
+        REQUIRE(Cursor::fromText(cursor.toText()) == cursor);
+        const std::vector<std::uint8_t> binary {cursor.toBinary()};
+        REQUIRE(binary.size() == 30 + 4 * 4);
+        REQUIRE(Cursor::fromBinary(binary) == cursor);
+
+        auto resumed {u.begin(Cursor::fromBinary(binary))};
+        REQUIRE(resumed == it);
+        REQUIRE(to_string(*++resumed) == "2 1 2 2");
+        REQUIRE(u.begin(u.end().cursor()) == u.end());
+        REQUIRE(Cursor::fromText("UrnOR 3 4 81 0 0 0 0") == u.end().cursor());
+
+        REQUIRE_THROWS_AS((u.begin(Cursor::fromText("UrnOR 3 4 70 2 1 2 2"))),std::domain_error);
+        REQUIRE_THROWS_AS((u.begin(Cursor::fromText("UrnOR 4 4 70 2 1 2 1"))),std::domain_error);
+        REQUIRE_THROWS_AS((u.begin(Cursor::fromText("UrnO 3 4 70 2 1 2 1"))),std::domain_error);
+        REQUIRE_THROWS_AS(((u.begin() - 1).cursor()),std::domain_error);
+        REQUIRE_THROWS_AS((Cursor::fromText("UrnOR 3 4 70 2 1 2")),std::invalid_argument);
+        REQUIRE_THROWS_AS((Cursor::fromText("UrnX 3 4 70 2 1 2 1")),std::invalid_argument);
+        REQUIRE_THROWS_AS((Cursor::fromText("UrnOR 3 4 -70 2 1 2 1")),std::invalid_argument);
+        REQUIRE_THROWS_AS((Cursor::fromBinary(std::span<const std::uint8_t>{binary}.first(29))),std::invalid_argument);
+
+        REQUIRE(ordinalToString(0) == "0");
+        REQUIRE(stringToOrdinal(ordinalToString(maxOrdinal)) == maxOrdinal);
+        REQUIRE_THROWS_AS((stringToOrdinal(ordinalToString(maxOrdinal) + "0")),std::overflow_error);
+    }
 }
 
 //UrnO
@@ -335,6 +583,79 @@ TEST_CASE("UrnO")
         auto iter = 3 + u.begin();
         REQUIRE(to_string(*iter) == "1 2");
     }
+
+    //Test for large counts
+    SECTION("6")
+    {
+        REQUIRE(UrnO{13,13}.z() == 6227020800ULL);
+        REQUIRE(UrnO{20,20}.z() == 2432902008176640000ULL);
+        REQUIRE(factorial(20) == 2432902008176640000ULL);
+        REQUIRE_THROWS_AS((UrnO{40,40}.z()),std::overflow_error);
+    }
+
+    //Test for rank
+    SECTION("7")
+    {
+        UrnO u {6,4};
+        for(Ordinal ordinalCount {}; ordinalCount < u.z(); ++ordinalCount)
+        {
+            REQUIRE(u.rank(u.draw(ordinalCount)) == ordinalCount);
+        }
+        REQUIRE(UrnO{20,20}.rank(UrnO{20,20}.draw(2432902008176639999ULL)) == 2432902008176639999ULL);
+        REQUIRE((*u.begin(u.draw(7))) == u.draw(7));
+        REQUIRE(u.end()-u.begin(u.draw(7)) == 353);
+
+        REQUIRE_THROWS_AS((u.rank(Draw{0,1,2,2})),std::domain_error);
+        REQUIRE_THROWS_WITH((u.rank(Draw{0,1,2,2})),"There is no valid ordinalnumber for this draw.");
+        REQUIRE_THROWS_AS((u.rank(Draw{0})),std::domain_error);
+    }
+
+    //Test for incremental iteration
+    SECTION("8")
+    {
+        UrnO u {5,3};
+        Ordinal ordinalCount {};
+        for(auto it {u.begin()}; it != u.end(); ++it, ++ordinalCount)
+        {
+            REQUIRE((*it) == u.draw(ordinalCount));
+        }
+        REQUIRE(ordinalCount == u.z());
+        for(auto it {u.rbegin()}; it != u.rend(); ++it)
+        {
+            REQUIRE((*it) == u.draw(--ordinalCount));
+        }
+
+        auto it {u.begin()};
+        const Draw current {*it};
+        it += 5;
+        REQUIRE((*it) == u.draw(5));
+        REQUIRE(it[-2] == u.draw(3));
+        --it;
+        REQUIRE((*it) == u.draw(4));
+        REQUIRE(current == u.draw(0));
+        it += -3;
+        REQUIRE((*it) == u.draw(1));
+        REQUIRE(it.ordinalnumber() == 1);
+    }
+
+    //Test for successor and predecessor without filtering
+    SECTION("9")
+    {
+        UrnO u {12,12};
+        REQUIRE(to_string(u.nextDraw(Draw{0,1,2,3,4,5,6,7,8,11,10,9})) == "0 1 2 3 4 5 6 7 9 8 10 11");
+        REQUIRE(to_string(u.backDraw(Draw{0,1,2,3,4,5,6,7,9,8,10,11})) == "0 1 2 3 4 5 6 7 8 11 10 9");
+        REQUIRE(u.nextDraw(u.draw(123456789)) == u.draw(123456790));
+        REQUIRE(u.backDraw(u.draw(123456789)) == u.draw(123456788));
+        REQUIRE_THROWS_AS((u.nextDraw(u.lastDraw())),std::domain_error);
+        REQUIRE_THROWS_AS((u.backDraw(u.firstDraw())),std::domain_error);
+
+        UrnO v {130,3};
+        REQUIRE(to_string(v.nextDraw(Draw{64,129,128})) == "65 0 1");
+        REQUIRE(to_string(v.backDraw(Draw{65,0,1})) == "64 129 128");
+        REQUIRE(v.nextDraw(v.draw(1000000)) == v.draw(1000001));
+        REQUIRE(v.backDraw(v.draw(1000000)) == v.draw(999999));
+        REQUIRE_THROWS_AS((v.nextDraw(Draw{1,1,2})),std::domain_error);
+    }
 }
 
 
@@ -452,6 +773,92 @@ TEST_CASE("UrnR")
         auto iter = 3 + u.begin();
         REQUIRE(to_string(*iter) == "1 1");
     }
+
+    //Test for large counts
+    SECTION("6")
+    {
+        REQUIRE(UrnR{20,20}.z() == 68923264410ULL);
+        REQUIRE(binomial(67,33) == 14226520737620288370ULL);
+        REQUIRE_THROWS_AS(binomial(200,100),std::overflow_error);
+        static_assert(binomial(49,6) == 13983816);
+        static_assert(multiplyDivide(greatestCommonDivisor(12,18),10,4) == 15);
+    }
+
+    //Test for random access
+    SECTION("7")
+    {
+        UrnR u {20,20};
+        REQUIRE(to_string(u.draw(0)) == "0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0");
+        REQUIRE(to_string(u.draw(u.z()-1)) == "19 19 19 19 19 19 19 19 19 19 19 19 19 19 19 19 19 19 19 19");
+        REQUIRE(to_string(UrnR{50,6}.draw(12345678)) == "4 12 33 45 48 48");
+
+        UrnR v {5,3};
+        Draw current {v.firstDraw()};
+        for(Ordinal ordinalCount {1}; ordinalCount < v.z(); ++ordinalCount)
+        {
+            current = v.nextDraw(current);
+            REQUIRE(v.draw(ordinalCount) == current);
+        }
+    }
+
+    //Test for rank
+    SECTION("8")
+    {
+        UrnR u {5,4};
+        for(Ordinal ordinalCount {}; ordinalCount < u.z(); ++ordinalCount)
+        {
+            REQUIRE(u.rank(u.draw(ordinalCount)) == ordinalCount);
+        }
+        REQUIRE(UrnR{50,6}.rank(UrnR{50,6}.draw(12345678)) == 12345678);
+        REQUIRE((*u.begin(u.draw(7))) == u.draw(7));
+        REQUIRE(u.end()-u.begin(u.draw(7)) == 63);
+
+        REQUIRE_THROWS_AS((u.rank(Draw{0,2,1,3})),std::domain_error);
+        REQUIRE_THROWS_WITH((u.rank(Draw{0,2,1,3})),"There is no valid ordinalnumber for this draw.");
+        REQUIRE_THROWS_AS((u.rank(Draw{0})),std::domain_error);
+    }
+
+    //Test for incremental iteration
+    SECTION("9")
+    {
+        UrnR u {4,3};
+        Ordinal ordinalCount {};
+        for(auto it {u.begin()}; it != u.end(); ++it, ++ordinalCount)
+        {
+            REQUIRE((*it) == u.draw(ordinalCount));
+        }
+        REQUIRE(ordinalCount == u.z());
+        for(auto it {u.rbegin()}; it != u.rend(); ++it)
+        {
+            REQUIRE((*it) == u.draw(--ordinalCount));
+        }
+
+        auto it {u.begin()};
+        const Draw current {*it};
+        it += 5;
+        REQUIRE((*it) == u.draw(5));
+        REQUIRE(it[-2] == u.draw(3));
+        --it;
+        REQUIRE((*it) == u.draw(4));
+        REQUIRE(current == u.draw(0));
+        it += -3;
+        REQUIRE((*it) == u.draw(1));
+        REQUIRE(it.ordinalnumber() == 1);
+    }
+
+    //Test for successor and predecessor without filtering
+    SECTION("10")
+    {
+        UrnR u {30,5};
+        REQUIRE(to_string(u.nextDraw(Draw{0,1,2,29,29})) == "0 1 3 3 3");
+        REQUIRE(to_string(u.backDraw(Draw{0,1,3,3,3})) == "0 1 2 29 29");
+        REQUIRE(u.nextDraw(u.draw(100000)) == u.draw(100001));
+        REQUIRE(u.backDraw(u.draw(100000)) == u.draw(99999));
+        REQUIRE(to_string(u.lastDraw()) == "29 29 29 29 29");
+        REQUIRE_THROWS_AS((u.nextDraw(u.lastDraw())),std::domain_error);
+        REQUIRE_THROWS_AS((u.backDraw(u.firstDraw())),std::domain_error);
+        REQUIRE_THROWS_AS((u.nextDraw(Draw{0,2,1,3,4})),std::domain_error);
+    }
 }
 
 
@@ -577,8 +984,628 @@ TEST_CASE("Urn")
         auto iter = 2 + u.begin();
         REQUIRE(to_string(*iter) == "1 2");
     }
+
+    //Test for large counts
+    SECTION("6")
+    {
+        REQUIRE(Urn{40,20}.z() == 137846528820ULL);
+        REQUIRE(Urn{64,32}.z() == 1832624140942590534ULL);
+        REQUIRE(Urn{100,3}.z() == 161700);
+    }
+
+    //Test for random access
+    SECTION("7")
+    {
+        Urn u {50,6};
+        REQUIRE(to_string(u.draw(0)) == "0 1 2 3 4 5");
+        REQUIRE(to_string(u.draw(12345678)) == "10 15 30 37 39 48");
+        REQUIRE(to_string(u.draw(u.z()-1)) == "44 45 46 47 48 49");
+        REQUIRE(to_string(Urn{40,20}.draw(137846528819ULL)) == "20 21 22 23 24 25 26 27 28 29 30 31 32 33 34 35 36 37 38 39");
+
+        Urn v {7,3};
+        Draw current {v.firstDraw()};
+        for(Ordinal ordinalCount {1}; ordinalCount < v.z(); ++ordinalCount)
+        {
+            current = v.nextDraw(current);
+            REQUIRE(v.draw(ordinalCount) == current);
+        }
+    }
+
+    //Test for rank
+    SECTION("8")
+    {
+        Urn u {8,4};
+        for(Ordinal ordinalCount {}; ordinalCount < u.z(); ++ordinalCount)
+        {
+            REQUIRE(u.rank(u.draw(ordinalCount)) == ordinalCount);
+        }
+        REQUIRE(Urn{50,6}.rank(Urn{50,6}.draw(12345678)) == 12345678);
+        REQUIRE((*u.begin(u.draw(7))) == u.draw(7));
+        REQUIRE(u.end()-u.begin(u.draw(7)) == 63);
+
+        REQUIRE_THROWS_AS((u.rank(Draw{0,1,1,3})),std::domain_error);
+        REQUIRE_THROWS_WITH((u.rank(Draw{0,1,1,3})),"There is no valid ordinalnumber for this draw.");
+        REQUIRE_THROWS_AS((u.rank(Draw{0})),std::domain_error);
+    }
+
+    //Test for incremental iteration
+    SECTION("9")
+    {
+        Urn u {6,3};
+        Ordinal ordinalCount {};
+        for(auto it {u.begin()}; it != u.end(); ++it, ++ordinalCount)
+        {
+            REQUIRE((*it) == u.draw(ordinalCount));
+        }
+        REQUIRE(ordinalCount == u.z());
+        for(auto it {u.rbegin()}; it != u.rend(); ++it)
+        {
+            REQUIRE((*it) == u.draw(--ordinalCount));
+        }
+
+        auto it {u.begin()};
+        const Draw current {*it};
+        it += 5;
+        REQUIRE((*it) == u.draw(5));
+        REQUIRE(it[-2] == u.draw(3));
+        --it;
+        REQUIRE((*it) == u.draw(4));
+        REQUIRE(current == u.draw(0));
+        it += -3;
+        REQUIRE((*it) == u.draw(1));
+        REQUIRE(it.ordinalnumber() == 1);
+    }
+
+    //Test for successor and predecessor without filtering
+    SECTION("10")
+    {
+        Urn u {30,5};
+        REQUIRE(to_string(u.nextDraw(Draw{0,1,2,28,29})) == "0 1 3 4 5");
+        REQUIRE(to_string(u.backDraw(Draw{0,1,3,4,5})) == "0 1 2 28 29");
+        REQUIRE(u.nextDraw(u.draw(100000)) == u.draw(100001));
+        REQUIRE(u.backDraw(u.draw(100000)) == u.draw(99999));
+        REQUIRE(to_string(u.lastDraw()) == "25 26 27 28 29");
+        REQUIRE_THROWS_AS((u.nextDraw(u.lastDraw())),std::domain_error);
+        REQUIRE_THROWS_AS((u.backDraw(u.firstDraw())),std::domain_error);
+        REQUIRE_THROWS_AS((u.nextDraw(Draw{0,2,1,3,4})),std::domain_error);
+    }
+
+    //Test for fill
+    SECTION("11")
+    {
+        Urn u {30,5};
+        std::vector<uint> rows(5 * 1000);
+        u.fill(100000, 1000, rows);
+        std::vector<uint> columns(5 * 1000);
+        u.fill(100000, 1000, columns, Layout::columnMajor);
+        for(uint drawCount {}; drawCount < 1000; ++drawCount)
+        {
+            const Draw expected {u.draw(100000 + drawCount)};
+            REQUIRE(Draw(rows.begin() + drawCount * 5, rows.begin() + drawCount * 5 + 5) == expected);
+            for(uint posCount {}; posCount < 5; ++posCount)
+            {
+                REQUIRE(columns[posCount * 1000 + drawCount] == expected[posCount]);
+            }
+        }
+    }
+
+    //Test for sample, sample_n and CounterRng
+    SECTION("12")
+    {
+        Urn u {6,3};
+        CounterRng rng {42};
+        std::vector<uint> histogram(static_cast<std::size_t>(u.z()));
+        for(uint sampleCount {}; sampleCount < 20000; ++sampleCount)
+        {
+            const Draw draw {u.sample(rng)};
+            REQUIRE(u.valid(draw));
+            ++histogram[static_cast<std::size_t>(u.rank(draw))];
+        }
+        REQUIRE(rng.counter() >= 20000);
+        REQUIRE(std::all_of(histogram.begin(), histogram.end(), [](const uint& count){ return count > 850 && count < 1150; }));
+
+        CounterRng first {7, 3};
+        CounterRng second {7, 3};
+        std::vector<uint> draws(3 * 100);
+        u.sample_n(first, 100, draws);
+        for(uint drawCount {}; drawCount < 100; ++drawCount)
+        {
+            REQUIRE(Draw(draws.begin() + drawCount * 3, draws.begin() + drawCount * 3 + 3) == u.sample(second));
+        }
+        REQUIRE(first.counter() == second.counter());
+
+        CounterRng skipped {7, 3};
+        skipped.discard(5);
+        CounterRng stepped {7, 3};
+        for(uint stepCount {}; stepCount < 5; ++stepCount)
+        {
+            stepped();
+        }
+        REQUIRE(skipped() == stepped());
+        REQUIRE(CounterRng{7, 3}() != CounterRng{7, 4}());
+        REQUIRE(CounterRng{7, 3}() != CounterRng{8, 3}());
+
+        std::mt19937_64 mersenne {1};
+        REQUIRE(UrnOR{10,15}.sample(mersenne).size() == 15);
+        REQUIRE(uniformOrdinal(rng, 1) == 0);
+        REQUIRE_THROWS_AS((uniformOrdinal(rng, 0)),std::domain_error);
+        REQUIRE_THROWS_AS((u.sample_n(rng, 101, draws)),std::length_error);
+    }
+}
+
+
+//MinimalChange
+
+TEST_CASE("MinimalChange")
+{
+    //Test for UrnOR, reflected Gray code
+    SECTION("1")
+    {
+        UrnOR u {3,2};
+        MinimalChange mc {u};
+        std::string draws {};
+        for(; mc.valid(); mc.next())
+        {
+            draws += to_string(mc.draw()) + ",";
+        }
+        REQUIRE(draws == "0 0,0 1,0 2,1 2,1 1,1 0,2 0,2 1,2 2,");
+        REQUIRE(enumerateMinimalChange(UrnOR{4,3}));
+        REQUIRE(enumerateMinimalChange(UrnOR{1,3}));
+    }
+
+    //Test for Urn, revolving door
+    SECTION("2")
+    {
+        MinimalChange mc {Urn{5,3}};
+        REQUIRE(to_string(mc.draw()) == "0 1 2");
+        REQUIRE(mc.changes().empty());
+        REQUIRE(mc.next());
+        REQUIRE(to_string(mc.draw()) == "0 2 3");
+        REQUIRE(mc.changes().size() == 2);
+        REQUIRE(mc.changes()[0].position == 1);
+        REQUIRE(mc.changes()[0].oldBall == 1);
+        REQUIRE(mc.changes()[0].newBall == 2);
+        REQUIRE(mc.changes()[1].position == 2);
+        REQUIRE(mc.changes()[1].oldBall == 2);
+        REQUIRE(mc.changes()[1].newBall == 3);
+        REQUIRE(enumerateMinimalChange(Urn{7,4}));
+        REQUIRE(enumerateMinimalChange(Urn{6,1}));
+        REQUIRE(enumerateMinimalChange(Urn{5,5}));
+    }
+
+    //Test for UrnR, revolving door of the corresponding combinations
+    SECTION("3")
+    {
+        REQUIRE(enumerateMinimalChange(UrnR{4,3}));
+        REQUIRE(enumerateMinimalChange(UrnR{5,4}));
+        REQUIRE(enumerateMinimalChange(UrnR{1,3}));
+    }
+
+    //Test for UrnO, plain changes and revolving door
+    SECTION("4")
+    {
+        MinimalChange mc {UrnO{3,3}};
+        std::string draws {};
+        for(; mc.valid(); mc.next())
+        {
+            draws += to_string(mc.draw()) + ",";
+        }
+        REQUIRE(draws == "0 1 2,0 2 1,2 0 1,2 1 0,1 2 0,1 0 2,");
+        REQUIRE(enumerateMinimalChange(UrnO{6,3}));
+        REQUIRE(enumerateMinimalChange(UrnO{5,5}));
+        REQUIRE(enumerateMinimalChange(UrnO{5,1}));
+    }
+
+    //Test for empty urns
+    SECTION("5")
+    {
+        MinimalChange mc {UrnOR{3,0}};
+        REQUIRE(mc.valid() == false);
+        REQUIRE(mc.next() == false);
+    }
+}
+
+//SmallDraw
+
+TEST_CASE("SmallDraw")
+{
+    SECTION("1")
+    {
+        SmallDraw d {};
+        REQUIRE(d.empty());
+        d.resize(3);
+        REQUIRE(to_string(d.toVector()) == "0 0 0");
+        REQUIRE(d.isInline() == (3 <= URN_SMALL_DRAW_CAPACITY));
+        d.resize(URN_SMALL_DRAW_CAPACITY + 1);
+        REQUIRE(d.isInline() == false);
+        REQUIRE(d.size() == URN_SMALL_DRAW_CAPACITY + 1);
+        d[URN_SMALL_DRAW_CAPACITY] = 7;
+
+        SmallDraw copy {d};
+        REQUIRE(copy == d);
+        SmallDraw moved {std::move(copy)};
+        REQUIRE(moved == d);
+        REQUIRE(copy.empty());
+        REQUIRE((SmallDraw{1,2,3} == SmallDraw{1,2,3}));
+        REQUIRE((SmallDraw{1,2,3} == SmallDraw{1,2}) == false);
+    }
+
+    //Test for the draws of the urns
+    SECTION("2")
+    {
+        UrnO u {12,9};
+        for(Ordinal ordinalCount {}; ordinalCount < u.z(); ordinalCount += 99991)
+        {
+            const SmallDraw d {u.smallDraw(ordinalCount)};
+            REQUIRE(d.isInline() == (9 <= URN_SMALL_DRAW_CAPACITY));
+            REQUIRE(d.toVector() == u.draw(ordinalCount));
+        }
+        REQUIRE(UrnR{3,20}.smallDraw(5).toVector() == UrnR{3,20}.draw(5));
+        REQUIRE(Urn{30,5}.smallDraw(12345).toVector() == Urn{30,5}.draw(12345));
+        REQUIRE_THROWS_AS((Urn{30,5}.smallDraw(Urn{30,5}.z())),std::domain_error);
+
+        GenericUrn<char,true,false> v {2,{'A','B','C'}};
+        REQUIRE(to_string(v.smallDraw(5).toVector()) == "C B");
+    }
+}
+
+//StaticUrn
+
+template<class STATIC, class URN>
+bool compareStaticUrn()
+{
+    URN u {STATIC::n(), STATIC::k()};
+    if(STATIC::z() != u.z())
+    {
+        return false;
+    }
+    constexpr auto draws {STATIC::allDraws()};
+    for(Ordinal ordinalCount {}; ordinalCount < u.z(); ++ordinalCount)
+    {
+        const auto& d {draws[static_cast<std::size_t>(ordinalCount)]};
+        auto previous {d};
+        if(Draw(d.begin(), d.end()) != u.draw(ordinalCount) || STATIC::draw(ordinalCount) != d || STATIC::rank(d) != ordinalCount
+           || (ordinalCount > 0 && (!STATIC::predecessor(previous) || previous != draws[static_cast<std::size_t>(ordinalCount - 1)])))
+        {
+            return false;
+        }
+    }
+    auto last {draws.back()};
+    return !STATIC::successor(last);
+}
+
+TEST_CASE("StaticUrn")
+{
+    SECTION("1")
+    {
+        static_assert(StaticUrn<52,5,false,false>::z() == 2598960);
+        static_assert(StaticUrn<10,3>::draw(123) == StaticUrn<10,3>::StaticDraw{1,2,3});
+        static_assert(StaticUrn<52,5,false,false>::rank({47,48,49,50,51}) == 2598959);
+        static_assert(std::is_same_v<StaticUrn<300,2>::Ball, std::uint16_t>);
+        static_assert(StaticUrn<4,0>::z() == 0);
+        REQUIRE(StaticUrn<52,5,false,false>::draw(1000000) == StaticUrn<52,5,false,false>::StaticDraw{4,15,17,35,40});
+        REQUIRE(to_string(Urn{52,5}.draw(1000000)) == "4 15 17 35 40");
+        REQUIRE_THROWS_AS((StaticUrn<4,2>::draw(16)),std::domain_error);
+        REQUIRE_THROWS_AS((StaticUrn<4,2,true,false>::rank({1,1})),std::domain_error);
+    }
+
+    SECTION("2")
+    {
+        REQUIRE(compareStaticUrn<StaticUrn<4,3,true,true>, UrnOR>());
+        REQUIRE(compareStaticUrn<StaticUrn<5,3,true,false>, UrnO>());
+        REQUIRE(compareStaticUrn<StaticUrn<4,3,false,true>, UrnR>());
+        REQUIRE(compareStaticUrn<StaticUrn<6,3,false,false>, Urn>());
+        REQUIRE(compareStaticUrn<StaticUrn<4,4,true,false>, UrnO>());
+    }
+}
+
+//Parallel
+
+TEST_CASE("Parallel")
+{
+    //Test for parallel_for_each
+    SECTION("1")
+    {
+        UrnO u {9,6};
+        std::vector<std::atomic<uint>> visits(static_cast<std::size_t>(u.z()));
+        ThreadPool pool {4};
+        REQUIRE(pool.size() == 4);
+        parallel_for_each(pool, u, [&](const Draw& draw)
+        {
+            ++visits[static_cast<std::size_t>(u.rank(draw))];
+        }, 100);
+        REQUIRE(std::all_of(visits.begin(), visits.end(), [](const auto& visit){ return visit == 1; }));
+
+        GenericUrn<char,false,false> v {2,{'A','B','C','D'}};
+        std::atomic<uint> count {};
+        parallel_for_each(v, [&](const std::vector<char>& draw)
+        {
+            count += (draw.front() == 'A');
+        });
+        REQUIRE(count == 3);
+    }
+
+    //Test for parallel_transform_reduce, the result does not depend on the number of threads
+    SECTION("2")
+    {
+        Urn u {30,5};
+        auto concatenate = [](std::string left, const std::string& right){ return left + right; };
+        auto first = [](const Draw& draw){ return std::string(1, static_cast<char>('a' + draw[0] % 26)); };
+        ThreadPool one {1};
+        ThreadPool many {7};
+        const std::string serial {parallel_transform_reduce(one, u, std::string{">"}, concatenate, first, 5000)};
+        REQUIRE(serial.size() == u.z() + 1);
+        REQUIRE(parallel_transform_reduce(many, u, std::string{">"}, concatenate, first, 5000) == serial);
+
+        auto sum = [](Ordinal left, Ordinal right){ return left + right; };
+        auto total = [](const Draw& draw){ return static_cast<Ordinal>(std::accumulate(draw.begin(), draw.end(), 0u)); };
+        REQUIRE(parallel_transform_reduce(many, u, Ordinal{}, sum, total) == u.z() * 5 * 29 / 2);
+        UrnOR empty {3,0};
+        REQUIRE(parallel_transform_reduce(empty, Ordinal{7}, sum, total) == 7);
+    }
+
+    //Test for exceptions in tasks
+    SECTION("3")
+    {
+        ThreadPool pool {3};
+        UrnOR u {10,4};
+        REQUIRE_THROWS_AS((parallel_for_each(pool, u, [](const Draw& draw){ if(draw[0] == 7){ throw std::runtime_error("seven"); } })),std::runtime_error);
+        std::atomic<uint> count {};
+        parallel_for_each(pool, u, [&](const Draw&){ ++count; });
+        REQUIRE(count == 10000);
+    }
+
+    //Test for find_first, find_any and count_if
+    SECTION("4")
+    {
+        ThreadPool pool {4};
+        UrnO u {12,5};
+        auto high = [](const Draw& draw){ return draw[0] >= 7 && draw[1] == 3; };
+        const Ordinal first {static_cast<Ordinal>(std::find_if(u.begin(), u.end(), high) - u.begin())};
+        for(Ordinal grain: {Ordinal{1}, Ordinal{97}, Ordinal{0}})
+        {
+            REQUIRE(find_first(pool, u, high, grain) == first);
+            REQUIRE(high(u.draw(find_any(pool, u, high, grain))));
+        }
+        REQUIRE(to_string(u.draw(first)) == "7 3 0 1 2");
+        REQUIRE(count_if(pool, u, high) == 5 * 10 * 9 * 8);
+        auto none = [](const Draw&){ return false; };
+        REQUIRE(find_first(pool, u, none, 50) == u.z());
+        REQUIRE(find_any(pool, u, none) == u.z());
+        REQUIRE(count_if(u, none) == 0);
+
+        //Chunks above the first match are cancelled.
+        std::atomic<std::size_t> calls {};
+        auto counted = [&](const Draw& draw){ ++calls; return draw[0] == 0; };
+        REQUIRE(find_first(pool, u, counted, 100) == 0);
+        REQUIRE(calls < u.z());
+
+        GenericUrn<std::string,false,true> v {3,{"Red","Green","Blue","Black"}};
+        auto blue = [](const std::vector<std::string>& draw){ return draw.back() == "Blue"; };
+        REQUIRE(to_string(v.draw(find_first(v, blue))) == "Red Red Blue");
+        REQUIRE(count_if(pool, v, blue) == 6);
+    }
+}
+
+//Formatter
+
+TEST_CASE("Formatter")
+{
+    //Test for the predefined formats
+    SECTION("1")
+    {
+        const std::vector<uint> draws {0, 12, 3, 7, 100000, 9};
+        REQUIRE(Formatter{20}.toString(std::span{draws}.first(3)) == "0 12 3\n");
+        REQUIRE(Formatter{20, Format::csv}.toString(std::span{draws}.first(3)) == "0,12,3\n");
+        REQUIRE(Formatter{20, Format::jsonLines}.toString(std::span{draws}.first(3)) == "[0,12,3]\n");
+        REQUIRE(Formatter{20}.toString(std::span{draws}.last(3)) == "7 100000 9\n");
+        REQUIRE(Formatter{20, ";", "\r\n", "<", ">"}.toString(draws) == "<0;12;3;7;100000;9>\r\n");
+        REQUIRE(Formatter{20, Format::jsonLines}.toString(std::span<const uint>{}) == "[]\n");
+        REQUIRE(Formatter{20, " and then ", "."}.toString(std::span{draws}.first(3)) == "0 and then 12 and then 3.");
+    }
+
+    //Test for batches, only complete draws are written
+    SECTION("2")
+    {
+        Urn u {30,5};
+        std::vector<uint> draws(5 * 1000);
+        u.fill(0, 1000, draws);
+        const Formatter formatter {u.n()};
+        std::string expected {};
+        for(uint drawCount {}; drawCount < 1000; ++drawCount)
+        {
+            expected += to_string(u.draw(drawCount)) + "\n";
+        }
+
+        std::vector<char> buffer(100);
+        std::string text {};
+        std::size_t written {};
+        while(written < 1000)
+        {
+            const FormatResult result {formatter.write(std::span<const uint>{draws}.subspan(written * 5), 5, buffer)};
+            REQUIRE(result.draws > 0);
+            REQUIRE(result.bytes <= buffer.size());
+            text.append(buffer.data(), result.bytes);
+            written += result.draws;
+        }
+        REQUIRE(text == expected);
+        REQUIRE(formatter.maxSize(5) == 5 * 10 + 4 + 1);
+        REQUIRE(formatter.write(draws, 5, std::span<char>{buffer}.first(5)).draws == 0);
+        REQUIRE_THROWS_AS((formatter.write(std::span<const uint>{draws}.first(7), 5, buffer)),std::length_error);
+    }
 }
 
+//DrawFile
+
+TEST_CASE("DrawFile")
+{
+    //The process id makes the name unique, so that test runs in parallel do not share the file.
+    const std::string path {(std::filesystem::temp_directory_path() / ("UrnUnitTests." + std::to_string(::getpid()) + ".draws")).string()};
+
+    //Test for writing and reading draws of 1 and 2 bytes
+    SECTION("1")
+    {
+        UrnO u {10,4};
+        writeDrawFile(path, u, 100, 1000);
+        REQUIRE(std::filesystem::file_size(path) == 48 + 1000 * 4);
+        const DrawFile file {path};
+        REQUIRE(file.order());
+        REQUIRE_FALSE(file.repetition());
+        REQUIRE(file.n() == 10);
+        REQUIRE(file.k() == 4);
+        REQUIRE(file.width() == 1);
+        REQUIRE(file.first() == 100);
+        REQUIRE(file.size() == 1000);
+        REQUIRE(std::ranges::random_access_range<const DrawFile>);
+        for(std::size_t drawCount {}; drawCount < file.size(); ++drawCount)
+        {
+            REQUIRE(file[drawCount].toDraw() == u.draw(100 + drawCount));
+        }
+        REQUIRE((file.begin() + 999)[0].toDraw() == u.draw(1099));
+        REQUIRE(file.end() - file.begin() == 1000);
+
+        UrnR v {300,3};
+        writeDrawFile(path, v, v.z() - 10);
+        const DrawFile wide {path};
+        REQUIRE(wide.width() == 2);
+        REQUIRE(wide.size() == 10);
+        REQUIRE(to_string(wide[9].toDraw()) == "299 299 299");
+        REQUIRE(wide[9][2] == 299);
+        std::filesystem::remove(path);
+    }
+
+    //Test for errors
+    SECTION("2")
+    {
+        Urn u {5,2};
+        REQUIRE_THROWS_AS((writeDrawFile(path, u, 11)),std::domain_error);
+        writeDrawFile(path, u);
+        std::filesystem::resize_file(path, 48 + 19);
+        REQUIRE_THROWS_AS((DrawFile{path}),std::runtime_error);
+        std::ofstream {path} << "no draw file";
+        REQUIRE_THROWS_AS((DrawFile{path}),std::runtime_error);
+        std::filesystem::remove(path);
+        REQUIRE_THROWS_AS((DrawFile{path}),std::runtime_error);
+    }
+}
+
+//Drawgen
+
+TEST_CASE("Drawgen")
+{
+    //Test for parsing the options of the command line
+    SECTION("1")
+    {
+        const DrawgenOptions options {parseDrawgenOptions({"--n", "10", "--k", "3", "--order", "--shard", "2/5", "--from", "7", "--count", "100", "--threads", "4", "--format", "csv"})};
+        REQUIRE(options.n == 10);
+        REQUIRE(options.k == 3);
+        REQUIRE(options.order);
+        REQUIRE_FALSE(options.repetition);
+        REQUIRE(options.shard == 2);
+        REQUIRE(options.shards == 5);
+        REQUIRE(options.from == 7);
+        REQUIRE(options.count == 100);
+        REQUIRE(options.threads == 4);
+        REQUIRE(options.format == "csv");
+        REQUIRE(makeUrn(options)->z() == 720);
+
+        const DrawgenOptions defaults {parseDrawgenOptions({"--k", "2", "--n", "5", "--repetition"})};
+        REQUIRE(defaults.shards == 1);
+        REQUIRE(defaults.count == maxOrdinal);
+        REQUIRE(defaults.format == "plain");
+        REQUIRE(makeUrn(defaults)->z() == 15);
+
+        REQUIRE_THROWS_AS((parseDrawgenOptions({"--n", "5"})),std::invalid_argument);
+        REQUIRE_THROWS_AS((parseDrawgenOptions({"--n", "5", "--k", "2", "--size", "3"})),std::invalid_argument);
+        REQUIRE_THROWS_AS((parseDrawgenOptions({"--n", "5", "--k"})),std::invalid_argument);
+        REQUIRE_THROWS_AS((parseDrawgenOptions({"--n", "five", "--k", "2"})),std::invalid_argument);
+        REQUIRE_THROWS_AS((parseDrawgenOptions({"--n", "5", "--k", "2", "--shard", "3"})),std::invalid_argument);
+        REQUIRE_THROWS_AS((parseDrawgenOptions({"--n", "5", "--k", "2", "--format", "xml"})),std::invalid_argument);
+        REQUIRE_THROWS_AS((parseDrawgenOptions({"--n", "99999999999", "--k", "2"})),std::invalid_argument);
+    }
+
+    //Test for the draws selected by --shard, --from and --count
+    SECTION("2")
+    {
+        DrawgenOptions options {};
+        DrawSelection selection {selectDraws(options, 100)};
+        REQUIRE((selection.first == 0 && selection.count == 100));
+
+        options.shard = 2;
+        options.shards = 3;
+        selection = selectDraws(options, 100);
+        REQUIRE((selection.first == 67 && selection.count == 33));
+
+        options.from = 30;
+        selection = selectDraws(options, 100);
+        REQUIRE((selection.first == 97 && selection.count == 3));
+
+        options.count = 2;
+        selection = selectDraws(options, 100);
+        REQUIRE((selection.first == 97 && selection.count == 2));
+
+        options.from = 33;
+        selection = selectDraws(options, 100);
+        REQUIRE(selection.count == 0);
+
+        options.from = 34;
+        REQUIRE_THROWS_AS((selectDraws(options, 100)),std::invalid_argument);
+        options.from = 0;
+        options.shard = 3;
+        REQUIRE_THROWS_AS((selectDraws(options, 100)),std::invalid_argument);
+    }
+}
+
+TEST_CASE("Stats")
+{
+    //Test for the counters, which are only collected with -DURN_STATS
+    SECTION("1")
+    {
+        resetStats();
+        Urn u {5,3};
+        REQUIRE(to_string(u.draw(3)) == "0 2 3");
+        std::size_t count {};
+        for(const Draw& draw: u)
+        {
+            count += draw.size();
+        }
+        REQUIRE(count == 30);
+        REQUIRE(to_string(u.nextDraw({0,1,2})) == "0 1 3");
+        REQUIRE_THROWS_AS((u.nextDraw({1,1,2})),std::domain_error);
+        CounterRng rng {1};
+        std::vector<uint> buffer(2);
+        REQUIRE_THROWS_AS((u.sample_n(rng, 1, buffer)),std::length_error);
+
+        //draw(3), the first draw of begin(), the zeros of end() and ten copies of the iterator are allocated.
+        const Stats expected {statsEnabled ? Stats{2, 10, 1, 13, 2} : Stats{}};
+        REQUIRE(statsSnapshot() == expected);
+        resetStats();
+        REQUIRE(statsSnapshot() == Stats{});
+    }
+
+    //Test for combining the counters of several threads
+    SECTION("2")
+    {
+        Stats total {1, 2, 3, 4, 5};
+        total += Stats{1, 1, 1, 1, 1};
+        REQUIRE(total == Stats{2, 3, 4, 5, 6});
+    }
+
+    //Test for the counters of the workers of a ThreadPool, which are added to the calling thread
+    SECTION("3")
+    {
+        resetStats();
+        ThreadPool pool {4};
+        std::atomic<std::size_t> count {};
+        parallel_for_each(pool, Urn{10,3}, [&](const Draw&){ ++count; }, 12);
+        REQUIRE(count == 120);
+        //Every chunk of 12 draws unranks begin() and, except the first chunk, its first draw and walks to the start of the next chunk.
+        const Stats stats {statsSnapshot()};
+        REQUIRE(stats.unranks == (statsEnabled ? 19 : 0));
+        REQUIRE(stats.successorSteps == (statsEnabled ? 119 : 0));
+        resetStats();
+    }
+}
 
 //GenericUrn
 
@@ -809,6 +1836,91 @@ TEST_CASE("GenericUrn<TYPE,TRUE,FALSE>")
         auto iter = 2 + u.begin();
         REQUIRE(to_string(*iter) == "B A");
     }
+
+    //Test for rank
+    SECTION("6")
+    {
+        GenericUrn<char,true,false> u {3,{'A','B','C','D'}};
+        for(Ordinal ordinalCount {}; ordinalCount < u.z(); ++ordinalCount)
+        {
+            REQUIRE(u.rank(u.draw(ordinalCount)) == ordinalCount);
+        }
+        REQUIRE(u.rank({'D','C','B'}) == 23);
+        REQUIRE(to_string(*u.begin({'B','A','C'})) == "B A C");
+        REQUIRE_THROWS_AS((u.rank({'A','A','B'})),std::domain_error);
+
+        GenericUrn<std::string,false,false> w {2,{"Leia","Han","Luke","Chewbacca"}};
+        for(Ordinal ordinalCount {}; ordinalCount < w.z(); ++ordinalCount)
+        {
+            REQUIRE(w.rank(w.draw(ordinalCount)) == ordinalCount);
+        }
+        REQUIRE(w.to_draw({"Chewbacca","Leia"}) == Draw{3,0});
+        REQUIRE_THROWS_AS((w.rank({"Han","Lando"})),std::domain_error);
+    }
+
+    //Test for fill
+    SECTION("7")
+    {
+        GenericUrn<char,true,false> u {2,{'A','B','C'}};
+        std::vector<char> rows(6);
+        u.fill(1, 3, rows);
+        REQUIRE(to_string(rows) == "A C B A B C");
+        std::vector<char> columns(6);
+        u.fill(1, 3, columns, Layout::columnMajor);
+        REQUIRE(to_string(columns) == "A B B C A C");
+    }
+
+    //Test for the C++20 iterator concepts, const ranges and the end sentinel
+    SECTION("8")
+    {
+        using Iterator = GenericUrn<char,true,false>::Iterator;
+        REQUIRE(std::same_as<Iterator::iterator_concept,std::random_access_iterator_tag>);
+        REQUIRE(std::same_as<Iterator::iterator_category,std::random_access_iterator_tag>);
+        REQUIRE(std::sized_sentinel_for<std::default_sentinel_t,Iterator>);
+        REQUIRE(RandomAccessRange<const GenericUrn<char,true,false>>);
+
+        const GenericUrn<char,true,false> u {2,{'A','B','C'}};
+        REQUIRE(std::ranges::distance(u) == 6);
+        std::ranges::subrange tail {u.begin() + 4, std::default_sentinel};
+        REQUIRE(tail.size() == 2);
+        REQUIRE(to_string(*std::ranges::next(tail.begin())) == "C B");
+        REQUIRE(u.begin() + 6 == std::default_sentinel);
+        REQUIRE(u.begin()[1] != u.begin()[4]);
+        REQUIRE(to_string(u.begin()[4]) == "C A");
+
+        std::string reversed {};
+        for(const auto& draw: std::views::reverse(u))
+        {
+            reversed += to_string(draw) + ",";
+        }
+        REQUIRE(reversed == "C B,C A,B C,B A,A C,A B,");
+    }
+
+    //Test for shard
+    SECTION("9")
+    {
+        const GenericUrn<char,true,false> u {2,{'A','B','C'}};
+        REQUIRE(u.shard(0, 4).size() == 2);
+        REQUIRE(u.shard(3, 4).size() == 1);
+        REQUIRE(to_string(*u.shard(2, 4).begin()) == "C A");
+        REQUIRE_THROWS_AS((u.shard(4, 4)),std::domain_error);
+    }
+
+    //Test for sample and sample_n
+    SECTION("10")
+    {
+        const GenericUrn<char,true,false> u {2,{'A','B','C'}};
+        CounterRng first {1};
+        CounterRng second {1};
+        std::vector<char> draws(2 * 50);
+        u.sample_n(first, 50, draws);
+        for(uint drawCount {}; drawCount < 50; ++drawCount)
+        {
+            const std::vector<char> draw {u.sample(second)};
+            REQUIRE(draw[0] != draw[1]);
+            REQUIRE(std::vector<char>(draws.begin() + drawCount * 2, draws.begin() + drawCount * 2 + 2) == draw);
+        }
+    }
 }
 
 //GenericUrn<TYPE,FALSE,TRUE> = UrnR
@@ -1053,4 +2165,14 @@ TEST_CASE("GenericUrn<TYPE,FALSE,FALSE>")
         auto iter = 2 + u.begin();
         REQUIRE(per::outputPerson(*iter) == "Obi-Wan,38 Ahsoka,17");
     }
+
+    //Test for rank
+    SECTION("6")
+    {
+        GenericUrn<per::Person,false,false> u {2,{{"Anakin",22},{"Obi-Wan",38},{"Ahsoka",17}}};
+        REQUIRE(u.rank({{"Anakin",22},{"Obi-Wan",38}}) == 0);
+        REQUIRE(u.rank({{"Obi-Wan",38},{"Ahsoka",17}}) == 2);
+        REQUIRE(per::outputPerson(*u.begin({{"Anakin",22},{"Ahsoka",17}})) == "Anakin,22 Ahsoka,17");
+        REQUIRE_THROWS_AS((u.rank({{"Ahsoka",17},{"Anakin",22}})),std::domain_error);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,137 @@
+/*!
+ * \file cli.cpp
+ * \date October 17, 2026
+ *
+ * Implementation file of the command line options of drawgen
+ */
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <algorithm>
+
+#include "cli.hpp"
+
+namespace urn
+{
+    namespace
+    {
+        uint toUint(const std::string& text)
+        {
+            const Ordinal value {stringToOrdinal(text)};
+            if(value > static_cast<Ordinal>(static_cast<uint>(-1)))
+            {
+                throw std::invalid_argument("The value " + text + " is too large.");
+            }
+            return static_cast<uint>(value);
+        }
+    }
+
+    DrawgenOptions parseDrawgenOptions(const std::vector<std::string>& arguments)
+    {
+        DrawgenOptions options {};
+        bool hasN {};
+        bool hasK {};
+        for(std::size_t argCount {}; argCount < arguments.size(); ++argCount)
+        {
+            const std::string& option {arguments[argCount]};
+            if(option == "--order")
+            {
+                options.order = true;
+                continue;
+            }
+            if(option == "--repetition")
+            {
+                options.repetition = true;
+                continue;
+            }
+            if(argCount + 1 >= arguments.size())
+            {
+                throw std::invalid_argument("The option " + option + " is unknown or has no value.");
+            }
+            const std::string& value {arguments[++argCount]};
+            if(option == "--n")
+            {
+                options.n = toUint(value);
+                hasN = true;
+            }
+            else if(option == "--k")
+            {
+                options.k = toUint(value);
+                hasK = true;
+            }
+            else if(option == "--shard")
+            {
+                const auto slash {value.find('/')};
+                if(slash == std::string::npos)
+                {
+                    throw std::invalid_argument("The shard must be given as I/M.");
+                }
+                options.shard = stringToOrdinal(value.substr(0, slash));
+                options.shards = stringToOrdinal(value.substr(slash + 1));
+            }
+            else if(option == "--from")
+            {
+                options.from = stringToOrdinal(value);
+            }
+            else if(option == "--count")
+            {
+                options.count = stringToOrdinal(value);
+            }
+            else if(option == "--threads")
+            {
+                options.threads = toUint(value);
+            }
+            else if(option == "--format")
+            {
+                if(value != "plain" && value != "csv" && value != "jsonl" && value != "count")
+                {
+                    throw std::invalid_argument("The format " + value + " is unknown.");
+                }
+                options.format = value;
+            }
+            else
+            {
+                throw std::invalid_argument("The option " + option + " is unknown.");
+            }
+        }
+        if(!hasN || !hasK)
+        {
+            throw std::invalid_argument("--n and --k are required.");
+        }
+        return options;
+    }
+
+    std::unique_ptr<UrnOR> makeUrn(const DrawgenOptions& options)
+    {
+        if(options.order)
+        {
+            if(options.repetition)
+            {
+                return std::make_unique<UrnOR>(options.n, options.k);
+            }
+            return std::make_unique<UrnO>(options.n, options.k);
+        }
+        if(options.repetition)
+        {
+            return std::make_unique<UrnR>(options.n, options.k);
+        }
+        return std::make_unique<Urn>(options.n, options.k);
+    }
+
+    DrawSelection selectDraws(const DrawgenOptions& options, const Ordinal& z)
+    {
+        if(options.shard >= options.shards)
+        {
+            throw std::invalid_argument("The shard index must be smaller than the number of shards.");
+        }
+        const Ordinal shardFirst {shardBegin(z, options.shard, options.shards)};
+        const Ordinal shardSize {shardBegin(z, options.shard + 1, options.shards) - shardFirst};
+        if(options.from > shardSize)
+        {
+            throw std::invalid_argument("--from is after the end of the draws.");
+        }
+        return DrawSelection{shardFirst + options.from, std::min(options.count, shardSize - options.from)};
+    }
+}
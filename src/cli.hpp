@@ -0,0 +1,76 @@
+/*!
+ * \file cli.hpp
+ * \date October 17, 2026
+ *
+ * Header file of the command line options of drawgen
+ *
+ * The options are parsed and the selected draws are calculated here instead of in drawgen.cpp,
+ * so that they can be tested without starting the program.
+ */
+
+/*!
+ * Include guard for cli.hpp
+ */
+#ifndef CLI_HPP
+#define CLI_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "urn.hpp"
+
+namespace urn
+{
+    /*!
+     * \struct DrawgenOptions
+     * \brief Options of the command line of drawgen.
+     */
+    struct DrawgenOptions
+    {
+        uint n {};                      //!< The number of balls inside the urn.
+        uint k {};                      //!< The size of a draw.
+        bool order {};                  //!< Indicates whether the order is important.
+        bool repetition {};             //!< Indicates whether the urn model contains repetitions.
+        Ordinal shard {};               //!< The index of the shard.
+        Ordinal shards {1};             //!< The number of shards.
+        Ordinal from {};                //!< Ordinal number of the first draw, relative to the shard.
+        Ordinal count {maxOrdinal};     //!< Number of draws, by default all remaining draws.
+        uint threads {1};               //!< Number of threads, 0 selects all cores.
+        std::string format {"plain"};   //!< plain, csv, jsonl or count.
+    };
+
+    /*!
+     * \struct DrawSelection
+     * \brief The draws selected by the options, as ordinal numbers of the urn.
+     */
+    struct DrawSelection
+    {
+        Ordinal first {};   //!< Ordinal number of the first selected draw.
+        Ordinal count {};   //!< Number of selected draws.
+    };
+
+    /*!
+     * \brief Parses the arguments of the command line, without the program name.
+     * If an option is unknown, has no value or an invalid value, or if --n or --k is missing, an std::invalid_argument is thrown.
+     * @param[in] arguments  The arguments of the command line.
+     * \return The options of type DrawgenOptions.
+     */
+    DrawgenOptions parseDrawgenOptions(const std::vector<std::string>& arguments);
+
+    /*!
+     * \brief Creates the urn model selected by --order and --repetition.
+     * If the urn is not valid, an std::domain_error is thrown.
+     * \return The urn, Urn if neither flag is set.
+     */
+    std::unique_ptr<UrnOR> makeUrn(const DrawgenOptions& options);
+
+    /*!
+     * \brief Calculates the draws selected by --shard, --from and --count of an urn with z draws.
+     * count is reduced to the draws remaining in the shard.
+     * If the shard index is not smaller than the number of shards or --from is after the end of the shard, an std::invalid_argument is thrown.
+     * \return The first ordinal number and the number of the selected draws.
+     */
+    DrawSelection selectDraws(const DrawgenOptions& options, const Ordinal& z);
+}
+#endif // CLI_HPP
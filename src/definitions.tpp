@@ -8,10 +8,112 @@
 
 #include <vector>
 #include <string>
+#include <array>
+#include <cstdint>
+#include <type_traits>
 
 using uint              = unsigned int;
 using Draw              = std::vector<uint>;
 
+//Helper functions
+
+constexpr Ordinal checkedAdd(const Ordinal& a, const Ordinal& b)
+{
+    Ordinal result {};
+    if(__builtin_add_overflow(a, b, &result))
+    {
+        throwException<std::overflow_error>("The number of draws exceeds the range of the ordinal type.");
+    }
+    return result;
+}
+
+constexpr Ordinal checkedMultiply(const Ordinal& a, const Ordinal& b)
+{
+    Ordinal result {};
+    if(__builtin_mul_overflow(a, b, &result))
+    {
+        throwException<std::overflow_error>("The number of draws exceeds the range of the ordinal type.");
+    }
+    return result;
+}
+
+constexpr Ordinal greatestCommonDivisor(Ordinal a, Ordinal b)
+{
+    while(b != 0)
+    {
+        const Ordinal rest {a % b};
+        a = b;
+        b = rest;
+    }
+    return a;
+}
+
+constexpr Ordinal multiplyDivide(Ordinal a, Ordinal b, Ordinal c)
+{
+#if !defined(URN_ORDINAL_128)
+    //The product of two 64 bit values fits into unsigned __int128, so the factors need not be reduced.
+    const unsigned __int128 result {static_cast<unsigned __int128>(a) * b / c};
+    if(result > maxOrdinal)
+    {
+        throwException<std::overflow_error>("The number of draws exceeds the range of the ordinal type.");
+    }
+    return static_cast<Ordinal>(result);
+#else
+    const Ordinal commonA {greatestCommonDivisor(a, c)};
+    a /= commonA;
+    c /= commonA;
+    const Ordinal commonB {greatestCommonDivisor(b, c)};
+    b /= commonB;
+    c /= commonB;
+    return checkedMultiply(a, b) / c;
+#endif
+}
+
+constexpr Ordinal power(const uint& n, const uint& k)
+{
+    Ordinal result {1};
+    for(uint upCount {}; upCount < k; ++upCount)
+    {
+        result = checkedMultiply(result, n);
+    }
+    return result;
+}
+
+constexpr Ordinal factorial(const uint& n)
+{
+    return fallingFactorial(n, n);
+}
+
+constexpr Ordinal fallingFactorial(const uint& n, const uint& k)
+{
+    if(k > n)
+    {
+        return 0;
+    }
+    Ordinal result {1};
+    for(uint upCount {}; upCount < k; ++upCount)
+    {
+        result = checkedMultiply(result, n - upCount);
+    }
+    return result;
+}
+
+constexpr Ordinal binomial(const uint& n, const uint& k)
+{
+    if(k > n)
+    {
+        return 0;
+    }
+    const uint r {std::min(k, n - k)};
+    Ordinal result {1};
+    //After step i the result is binomial(n-r+i, i), which never exceeds binomial(n, r).
+    for(uint i {1}; i <= r; ++i)
+    {
+        result = multiplyDivide(result, n - r + i, i);
+    }
+    return result;
+}
+
 //UrnSelector
 
 template <bool O, bool R>
@@ -38,12 +140,581 @@ struct UrnSelector<false, false>
     using UrnType = Urn;
 };
 
+//StaticUrn
+
+template<uint N, uint K, bool ORDER, bool REPETITION>
+class StaticUrn
+{
+    static_assert(N <= 65536, "StaticUrn supports at most 65536 balls.");
+    static_assert(!(N == 0 && K > 0), "StaticUrn with n == 0 and k > 0 is not valid.");
+    static_assert(REPETITION || K <= N, "StaticUrn without repetition requires k <= n.");
+
+    public:
+        using Ball = std::conditional_t<(N <= 256), std::uint8_t, std::uint16_t>;     /*!< Using decleration for the type of a ball. */
+        using StaticDraw = std::array<Ball, K>;                                       /*!< Using decleration for a draw of K balls. */
+
+        static constexpr uint n()
+        {
+            return N;
+        }
+
+        static constexpr uint k()
+        {
+            return K;
+        }
+
+        static constexpr Ordinal z()
+        {
+            if(K == 0)
+            {
+                return 0;
+            }
+            if(ORDER && REPETITION)
+            {
+                return power(N, K);
+            }
+            if(ORDER)
+            {
+                return fallingFactorial(N, K);
+            }
+            return REPETITION ? binomial(N + K - 1, K) : binomial(N, K);
+        }
+
+        static constexpr StaticDraw draw(Ordinal ordinalnumber)
+        {
+            if(ordinalnumber >= z())
+            {
+                throwException<std::domain_error>("There is no valid draw for this ordinalnumber.");
+            }
+            StaticDraw result {};
+            if(ORDER && REPETITION)
+            {
+                for(uint downCount {K}; downCount > 0; --downCount)
+                {
+                    result[downCount - 1] = static_cast<Ball>(ordinalnumber % N);
+                    ordinalnumber /= N;
+                }
+            }
+            else if(ORDER)
+            {
+                //Lehmer code, then every ball skips the balls of its left neighbours.
+                Ordinal currentVariations {z()};
+                for(uint upCount {}; upCount < K; ++upCount)
+                {
+                    currentVariations /= (N - upCount);
+                    result[upCount] = static_cast<Ball>(ordinalnumber / currentVariations);
+                    ordinalnumber %= currentVariations;
+                }
+                for(uint downCount {K}; downCount > 1; --downCount)
+                {
+                    for(uint upCount {downCount - 1}; upCount < K; ++upCount)
+                    {
+                        if(result[upCount] >= result[downCount - 2])
+                        {
+                            ++result[upCount];
+                        }
+                    }
+                }
+            }
+            else
+            {
+                //Combinatorial number system, UrnR uses the combinations of n+k-1 balls (stars and bars).
+                const uint balls {REPETITION ? N + K - 1 : N};
+                uint ball {};
+                for(uint posCount {}; posCount < K; ++posCount, ++ball)
+                {
+                    for(Ordinal count {binomial(balls - 1 - ball, K - 1 - posCount)}; ordinalnumber >= count; count = binomial(balls - 1 - ball, K - 1 - posCount))
+                    {
+                        ordinalnumber -= count;
+                        ++ball;
+                    }
+                    result[posCount] = static_cast<Ball>(REPETITION ? ball - posCount : ball);
+                }
+            }
+            return result;
+        }
+
+        static constexpr Ordinal rank(const StaticDraw& draw)
+        {
+            if(K == 0 || !contains(draw))
+            {
+                throwException<std::domain_error>("There is no valid ordinalnumber for this draw.");
+            }
+            Ordinal result {};
+            if(ORDER)
+            {
+                for(uint posCount {}; posCount < K; ++posCount)
+                {
+                    uint digit {draw[posCount]};
+                    if(!REPETITION)
+                    {
+                        for(uint leftCount {}; leftCount < posCount; ++leftCount)
+                        {
+                            digit -= (draw[leftCount] < draw[posCount]);
+                        }
+                    }
+                    result = checkedMultiply(result, REPETITION ? N : N - posCount) + digit;
+                }
+                return result;
+            }
+            const uint balls {REPETITION ? N + K - 1 : N};
+            uint ball {};
+            for(uint posCount {}; posCount < K; ++posCount, ++ball)
+            {
+                for(const uint target {REPETITION ? draw[posCount] + posCount : draw[posCount]}; ball < target; ++ball)
+                {
+                    result += binomial(balls - 1 - ball, K - 1 - posCount);
+                }
+            }
+            return result;
+        }
+
+        static constexpr bool successor(StaticDraw& draw)
+        {
+            for(uint downCount {K}; downCount > 0; --downCount)
+            {
+                const uint pos {downCount - 1};
+                if(ORDER && !REPETITION)
+                {
+                    //Smallest ball above draw[pos] which is not used on the left, the tail gets the smallest unused balls.
+                    std::array<bool, N> used {};
+                    for(uint leftCount {}; leftCount < pos; ++leftCount)
+                    {
+                        used[draw[leftCount]] = true;
+                    }
+                    uint ball {draw[pos] + 1u};
+                    while(ball < N && used[ball])
+                    {
+                        ++ball;
+                    }
+                    if(ball < N)
+                    {
+                        draw[pos] = static_cast<Ball>(ball);
+                        used[ball] = true;
+                        uint nextBall {};
+                        for(uint upCount {downCount}; upCount < K; ++upCount, ++nextBall)
+                        {
+                            while(used[nextBall])
+                            {
+                                ++nextBall;
+                            }
+                            draw[upCount] = static_cast<Ball>(nextBall);
+                        }
+                        return true;
+                    }
+                }
+                else if(draw[pos] < maximum(pos))
+                {
+                    ++draw[pos];
+                    for(uint upCount {downCount}; upCount < K; ++upCount)
+                    {
+                        draw[upCount] = ORDER ? 0 : static_cast<Ball>(draw[upCount - 1] + (REPETITION ? 0 : 1));
+                    }
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static constexpr bool predecessor(StaticDraw& draw)
+        {
+            for(uint downCount {K}; downCount > 0; --downCount)
+            {
+                const uint pos {downCount - 1};
+                if(ORDER && !REPETITION)
+                {
+                    //Largest ball below draw[pos] which is not used on the left, the tail gets the largest unused balls.
+                    std::array<bool, N> used {};
+                    for(uint leftCount {}; leftCount < pos; ++leftCount)
+                    {
+                        used[draw[leftCount]] = true;
+                    }
+                    uint ball {draw[pos]};
+                    while(ball > 0 && used[ball - 1])
+                    {
+                        --ball;
+                    }
+                    if(ball > 0)
+                    {
+                        draw[pos] = static_cast<Ball>(ball - 1);
+                        used[ball - 1] = true;
+                        uint nextBall {N};
+                        for(uint upCount {downCount}; upCount < K; ++upCount)
+                        {
+                            do
+                            {
+                                --nextBall;
+                            }while(used[nextBall]);
+                            draw[upCount] = static_cast<Ball>(nextBall);
+                        }
+                        return true;
+                    }
+                }
+                else if(draw[pos] > minimum(draw, pos))
+                {
+                    --draw[pos];
+                    for(uint upCount {downCount}; upCount < K; ++upCount)
+                    {
+                        draw[upCount] = static_cast<Ball>(maximum(upCount));
+                    }
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static constexpr auto allDraws()
+        {
+            std::array<StaticDraw, static_cast<std::size_t>(z())> result {};
+            if(result.empty())
+            {
+                return result;
+            }
+            result[0] = draw(0);
+            for(std::size_t drawCount {1}; drawCount < result.size(); ++drawCount)
+            {
+                result[drawCount] = result[drawCount - 1];
+                successor(result[drawCount]);
+            }
+            return result;
+        }
+
+        static constexpr bool contains(const StaticDraw& draw)
+        {
+            for(uint posCount {}; posCount < K; ++posCount)
+            {
+                if(draw[posCount] >= N)
+                {
+                    return false;
+                }
+                for(uint leftCount {}; leftCount < posCount; ++leftCount)
+                {
+                    if((!REPETITION && draw[leftCount] == draw[posCount]) || (!ORDER && draw[leftCount] > draw[posCount]))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+    private:
+        //Largest ball at position pos, for the urns except UrnO.
+        static constexpr uint maximum(uint pos)
+        {
+            return (ORDER || REPETITION) ? N - 1 : N - K + pos;
+        }
+
+        //Smallest ball at position pos with the given left neighbour, for the urns except UrnO.
+        static constexpr uint minimum(const StaticDraw& draw, uint pos)
+        {
+            if(ORDER || pos == 0)
+            {
+                return 0;
+            }
+            return REPETITION ? draw[pos - 1] : draw[pos - 1] + 1u;
+        }
+};
+
+//BasicSmallDraw
+
+template<class T, std::size_t N>
+BasicSmallDraw<T, N>::BasicSmallDraw() = default;
+
+template<class T, std::size_t N>
+BasicSmallDraw<T, N>::BasicSmallDraw(size_type size, const T& value)
+{
+    resize(size);
+    std::fill(begin(), end(), value);
+}
+
+template<class T, std::size_t N>
+BasicSmallDraw<T, N>::BasicSmallDraw(std::initializer_list<T> values)
+{
+    resize(values.size());
+    std::copy(values.begin(), values.end(), begin());
+}
+
+template<class T, std::size_t N>
+BasicSmallDraw<T, N>::BasicSmallDraw(const BasicSmallDraw& other)
+{
+    resize(other.size());
+    std::copy(other.begin(), other.end(), begin());
+}
+
+template<class T, std::size_t N>
+BasicSmallDraw<T, N>::BasicSmallDraw(BasicSmallDraw&& other) noexcept: m_inline { other.m_inline },
+                                                                 m_heap { std::move(other.m_heap) },
+                                                                 m_size { other.m_size },
+                                                                 m_capacity { other.m_capacity }
+{
+    other.m_size = 0;
+    other.m_capacity = N;
+}
+
+template<class T, std::size_t N>
+BasicSmallDraw<T, N>& BasicSmallDraw<T, N>::operator=(const BasicSmallDraw& other)
+{
+    if(this != &other)
+    {
+        resize(other.size());
+        std::copy(other.begin(), other.end(), begin());
+    }
+    return *this;
+}
+
+template<class T, std::size_t N>
+BasicSmallDraw<T, N>& BasicSmallDraw<T, N>::operator=(BasicSmallDraw&& other) noexcept
+{
+    if(this != &other)
+    {
+        m_inline = other.m_inline;
+        m_heap = std::move(other.m_heap);
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        other.m_size = 0;
+        other.m_capacity = N;
+    }
+    return *this;
+}
+
+template<class T, std::size_t N>
+void BasicSmallDraw<T, N>::resize(size_type size)
+{
+    if(size > m_capacity)
+    {
+        std::unique_ptr<T[]> heap {new T[size]{}};
+        std::copy(begin(), end(), heap.get());
+        m_heap = std::move(heap);
+        m_capacity = size;
+    }
+    else if(size > m_size)
+    {
+        std::fill(data() + m_size, data() + size, T{});
+    }
+    m_size = size;
+}
+
+template<class T, std::size_t N>
+typename BasicSmallDraw<T, N>::size_type BasicSmallDraw<T, N>::size() const
+{
+    return m_size;
+}
+
+template<class T, std::size_t N>
+bool BasicSmallDraw<T, N>::empty() const
+{
+    return m_size == 0;
+}
+
+template<class T, std::size_t N>
+bool BasicSmallDraw<T, N>::isInline() const
+{
+    return !m_heap;
+}
+
+template<class T, std::size_t N>
+T* BasicSmallDraw<T, N>::data()
+{
+    return m_heap ? m_heap.get() : m_inline.data();
+}
+
+template<class T, std::size_t N>
+const T* BasicSmallDraw<T, N>::data() const
+{
+    return m_heap ? m_heap.get() : m_inline.data();
+}
+
+template<class T, std::size_t N>
+T* BasicSmallDraw<T, N>::begin()
+{
+    return data();
+}
+
+template<class T, std::size_t N>
+T* BasicSmallDraw<T, N>::end()
+{
+    return data() + m_size;
+}
+
+template<class T, std::size_t N>
+const T* BasicSmallDraw<T, N>::begin() const
+{
+    return data();
+}
+
+template<class T, std::size_t N>
+const T* BasicSmallDraw<T, N>::end() const
+{
+    return data() + m_size;
+}
+
+template<class T, std::size_t N>
+T& BasicSmallDraw<T, N>::operator[](size_type index)
+{
+    return data()[index];
+}
+
+template<class T, std::size_t N>
+const T& BasicSmallDraw<T, N>::operator[](size_type index) const
+{
+    return data()[index];
+}
+
+template<class T, std::size_t N>
+std::vector<T> BasicSmallDraw<T, N>::toVector() const
+{
+    return std::vector<T>(begin(), end());
+}
+
+template<class T, std::size_t N>
+bool BasicSmallDraw<T, N>::operator==(const BasicSmallDraw& other) const
+{
+    return std::equal(begin(), end(), other.begin(), other.end());
+}
+
+//ReverseIterator
+
+template<class ITERATOR>
+ReverseIterator<ITERATOR>::ReverseIterator() = default;
+
+template<class ITERATOR>
+ReverseIterator<ITERATOR>::ReverseIterator(const ITERATOR& base): m_current{ base }
+{
+    --m_current;
+}
+
+template<class ITERATOR>
+ITERATOR ReverseIterator<ITERATOR>::base() const
+{
+    return m_current + 1;
+}
+
+template<class ITERATOR>
+typename ReverseIterator<ITERATOR>::reference ReverseIterator<ITERATOR>::operator*() const
+{
+    return *m_current;
+}
+
+template<class ITERATOR>
+ReverseIterator<ITERATOR>& ReverseIterator<ITERATOR>::operator++()
+{
+    --m_current;
+    return *this;
+}
+
+template<class ITERATOR>
+ReverseIterator<ITERATOR> ReverseIterator<ITERATOR>::operator++(int)
+{
+    auto temp {*this};
+    ++(*this);
+    return temp;
+}
+
+template<class ITERATOR>
+ReverseIterator<ITERATOR>& ReverseIterator<ITERATOR>::operator--()
+{
+    ++m_current;
+    return *this;
+}
+
+template<class ITERATOR>
+ReverseIterator<ITERATOR> ReverseIterator<ITERATOR>::operator--(int)
+{
+    auto temp {*this};
+    --(*this);
+    return temp;
+}
+
+template<class ITERATOR>
+bool ReverseIterator<ITERATOR>::operator== (const ReverseIterator& other) const
+{
+    return (m_current == other.m_current);
+}
+
+template<class ITERATOR>
+bool ReverseIterator<ITERATOR>::operator!= (const ReverseIterator& other) const
+{
+    return !(*this == other);
+}
+
+template<class ITERATOR>
+bool ReverseIterator<ITERATOR>::operator< (const ReverseIterator& other) const
+{
+    return (m_current > other.m_current);
+}
+
+template<class ITERATOR>
+bool ReverseIterator<ITERATOR>::operator> (const ReverseIterator& other) const
+{
+    return (m_current < other.m_current);
+}
+
+template<class ITERATOR>
+bool ReverseIterator<ITERATOR>::operator<=(const ReverseIterator& other) const
+{
+    return (*this == other || *this < other);
+}
+
+template<class ITERATOR>
+bool ReverseIterator<ITERATOR>::operator>=(const ReverseIterator& other) const
+{
+    return (*this == other || *this > other);
+}
+
+template<class ITERATOR>
+ReverseIterator<ITERATOR>& ReverseIterator<ITERATOR>::operator+=(const difference_type& n)
+{
+    m_current -= n;
+    return *this;
+}
+
+template<class ITERATOR>
+ReverseIterator<ITERATOR> ReverseIterator<ITERATOR>::operator+(const difference_type& n) const
+{
+    auto temp {*this};
+    return (temp += n);
+}
+
+template<class ITERATOR>
+ReverseIterator<ITERATOR>& ReverseIterator<ITERATOR>::operator-=(const difference_type& n)
+{
+    m_current += n;
+    return *this;
+}
+
+template<class ITERATOR>
+ReverseIterator<ITERATOR> ReverseIterator<ITERATOR>::operator-(const difference_type& n) const
+{
+    auto temp {*this};
+    return (temp -= n);
+}
+
+template<class ITERATOR>
+typename ReverseIterator<ITERATOR>::difference_type ReverseIterator<ITERATOR>::operator-(const ReverseIterator& other) const
+{
+    return other.m_current - m_current;
+}
+
+template<class ITERATOR>
+typename ReverseIterator<ITERATOR>::value_type ReverseIterator<ITERATOR>::operator[](const difference_type& n) const
+{
+    return m_current[-n];
+}
+
 //Iterator
 
 template<typename T, bool ORDER, bool REPETITION>
-GenericUrn<T, ORDER, REPETITION>::Iterator::Iterator(const GenericUrn<T,ORDER,REPETITION>* urn, const uint& ordinalnumber, const Status& status): m_itUrn{ urn },
-                                                                                                      m_ordinalnumber{ static_cast<int>(ordinalnumber) },
-                                                                                                      m_status { status }{}
+GenericUrn<T, ORDER, REPETITION>::Iterator::Iterator(const GenericUrn<T,ORDER,REPETITION>* urn, const Ordinal& ordinalnumber, const Status& status): m_itUrn{ urn },
+                                                                                                      m_ordinalnumber{ static_cast<SignedOrdinal>(ordinalnumber) },
+                                                                                                      m_status { status },
+                                                                                                      m_z { urn->z() }
+{
+    if(inRange())
+    {
+        load();
+    }
+}
 
 template<typename T, bool ORDER, bool REPETITION>
 GenericUrn<T, ORDER, REPETITION>::Iterator::Iterator() = default;
@@ -56,7 +727,7 @@ std::string GenericUrn<T,ORDER,REPETITION>::Iterator::status() const
         case Status::invalidFront: return "invalidFront"; break;
         case Status::valid: return "valid"; break;
         case Status::invalidBack: return "invalidBack"; break;
-        default: throw std::invalid_argument("m_status is invalid."); break;
+        default: throwException<std::invalid_argument>("m_status is invalid."); break;
     }
 }
 
@@ -73,43 +744,72 @@ uint GenericUrn<T,ORDER,REPETITION>::Iterator::k() const
 }
 
 template<typename T, bool ORDER, bool REPETITION>
-uint GenericUrn<T,ORDER,REPETITION>::Iterator::z() const
+Ordinal GenericUrn<T,ORDER,REPETITION>::Iterator::z() const
 {
-    return (*m_itUrn).z();
+    return m_z;
 }
 
 template<typename T, bool ORDER, bool REPETITION>
-int GenericUrn<T,ORDER,REPETITION>::Iterator::ordinalnumber() const
+SignedOrdinal GenericUrn<T,ORDER,REPETITION>::Iterator::ordinalnumber() const
 {
     return m_ordinalnumber;
 }
 
 template<typename T, bool ORDER, bool REPETITION>
-const typename GenericUrn<T,ORDER,REPETITION>::Iterator::value_type GenericUrn<T,ORDER,REPETITION>::Iterator::operator*() const 
+bool GenericUrn<T,ORDER,REPETITION>::Iterator::inRange() const
+{
+    return m_ordinalnumber >= 0 && static_cast<Ordinal>(m_ordinalnumber) < m_z;
+}
+
+template<typename T, bool ORDER, bool REPETITION>
+void GenericUrn<T,ORDER,REPETITION>::Iterator::updateStatus()
+{
+    if(m_ordinalnumber < 0)
+    {
+        m_status = Status::invalidFront;
+    }
+    else if(static_cast<Ordinal>(m_ordinalnumber) >= m_z)
+    {
+        m_status = Status::invalidBack;
+    }
+    else
+    {
+        m_status = Status::valid;
+    }
+}
+
+template<typename T, bool ORDER, bool REPETITION>
+void GenericUrn<T,ORDER,REPETITION>::Iterator::load()
+{
+    m_draw.resize(k());
+    (*m_itUrn).m_urn.unrank(static_cast<Ordinal>(m_ordinalnumber), m_draw);
+}
+
+template<typename T, bool ORDER, bool REPETITION>
+typename GenericUrn<T,ORDER,REPETITION>::Iterator::reference GenericUrn<T,ORDER,REPETITION>::Iterator::operator*() const 
 {   
-    if(m_ordinalnumber >= z() || m_ordinalnumber < 0)
+    if(!inRange())
     {   
-        throw std::domain_error("There is no valid draw for this ordinalnumber.");
+        throwException<std::domain_error>("There is no valid draw for this ordinalnumber.");
     }
-    return (*m_itUrn).draw(m_ordinalnumber);
+    return (*m_itUrn).to_element(m_draw);
 }
 
 template<typename T, bool ORDER, bool REPETITION>
 typename GenericUrn<T,ORDER,REPETITION>::Iterator& GenericUrn<T,ORDER,REPETITION>::Iterator::operator++()
 {   
+    const bool wasInRange {inRange()};
     ++m_ordinalnumber;
+    updateStatus();
 
-    if(m_ordinalnumber == 0)
-    {  
-        m_status = Status::valid;
-    }
-    else if(m_ordinalnumber < 0)
+    //Inside the range the draw is advanced in place, otherwise it is calculated from the ordinal number.
+    if(wasInRange && inRange())
     {
-        m_status = Status::invalidFront;
+        (*m_itUrn).m_urn.successor(m_draw);
     }
-    else if(m_ordinalnumber >= z())
+    else if(inRange())
     {
-        m_status = Status::invalidBack;
+        load();
     }
     return *this;
 }
@@ -125,19 +825,17 @@ typename GenericUrn<T,ORDER,REPETITION>::Iterator GenericUrn<T,ORDER,REPETITION>
 template<typename T, bool ORDER, bool REPETITION>
 typename GenericUrn<T,ORDER,REPETITION>::Iterator& GenericUrn<T,ORDER,REPETITION>::Iterator::operator--()
 {   
+    const bool wasInRange {inRange()};
     --m_ordinalnumber;
+    updateStatus();
 
-    if(m_ordinalnumber == z()-1)
-    {  
-        m_status = Status::valid;
-    }
-    else if(m_ordinalnumber < 0)
+    if(wasInRange && inRange())
     {
-        m_status = Status::invalidFront;
+        (*m_itUrn).m_urn.predecessor(m_draw);
     }
-    else if(m_ordinalnumber >= z())
+    else if(inRange())
     {
-        m_status = Status::invalidBack;
+        load();
     }
     return *this;
 }
@@ -189,19 +887,21 @@ bool GenericUrn<T,ORDER,REPETITION>::Iterator::operator>=(const typename Generic
 template<typename T, bool ORDER, bool REPETITION>
 typename GenericUrn<T,ORDER,REPETITION>::Iterator& GenericUrn<T,ORDER,REPETITION>::Iterator::operator+=(const typename GenericUrn<T,ORDER,REPETITION>::Iterator::difference_type& other)
 {   
-    if(other >= 0)
+    if(other == 1)
     {
-        for(uint incCount{}; incCount < other; ++incCount)
-        {
-            ++(*this);
-        }
+        return ++(*this);
     }
-    else if(other < 0)
-    {   
-        long int positivOther {other * -1};
-        for(uint decCount{}; decCount < positivOther; ++decCount)
+    if(other == -1)
+    {
+        return --(*this);
+    }
+    if(other != 0)
+    {
+        m_ordinalnumber += other;
+        updateStatus();
+        if(inRange())
         {
-            --(*this);
+            load();
         }
     }
     return *this;
@@ -217,7 +917,7 @@ typename GenericUrn<T,ORDER,REPETITION>::Iterator GenericUrn<T,ORDER,REPETITION>
 template<typename T, bool ORDER, bool REPETITION>
 typename GenericUrn<T,ORDER,REPETITION>::Iterator& GenericUrn<T,ORDER,REPETITION>::Iterator::operator-=(const typename GenericUrn<T,ORDER,REPETITION>::Iterator::difference_type& n)
 {
-    long int negativ {n * -1};
+    difference_type negativ {n * -1};
     (*this) += negativ;
     return *this;
 }
@@ -236,11 +936,18 @@ typename GenericUrn<T,ORDER,REPETITION>::Iterator::difference_type GenericUrn<T,
 }
 
 template<typename T, bool ORDER, bool REPETITION>
-typename GenericUrn<T,ORDER,REPETITION>::Iterator::reference GenericUrn<T,ORDER,REPETITION>::Iterator::operator[](typename GenericUrn<T,ORDER,REPETITION>::Iterator::size_type index) const 
+bool GenericUrn<T,ORDER,REPETITION>::Iterator::operator== (std::default_sentinel_t) const
+{
+    return m_ordinalnumber >= 0 && static_cast<Ordinal>(m_ordinalnumber) >= m_z;
+}
+
+template<typename T, bool ORDER, bool REPETITION>
+typename GenericUrn<T,ORDER,REPETITION>::Iterator::value_type GenericUrn<T,ORDER,REPETITION>::Iterator::operator[](const typename GenericUrn<T,ORDER,REPETITION>::Iterator::difference_type& n) const 
 { 
-    if(index >= z() || index < 0)
+    const SignedOrdinal index {m_ordinalnumber + n};
+    if(index < 0 || static_cast<Ordinal>(index) >= m_z)
     {   
-        throw std::domain_error("There is no valid draw for this ordinalnumber.");
+        throwException<std::domain_error>("There is no valid draw for this ordinalnumber.");
     }
     return (*m_itUrn).draw(index);
 }
@@ -248,11 +955,82 @@ typename GenericUrn<T,ORDER,REPETITION>::Iterator::reference GenericUrn<T,ORDER,
 template<typename T, bool ORDER, bool REPETITION>
 GenericUrn<T,ORDER,REPETITION>::Iterator::~Iterator() = default;
 
+//Random sampling
+
+template<class RNG>
+Ordinal uniformOrdinal(RNG& rng, const Ordinal& z)
+{
+    if(z == 0)
+    {
+        throwException<std::domain_error>("The urn contains no draw.");
+    }
+    auto word = [&rng]() -> std::uint64_t
+    {
+        if constexpr(RNG::min() == 0 && RNG::max() == std::numeric_limits<std::uint64_t>::max())
+        {
+            return static_cast<std::uint64_t>(rng());
+        }
+        else
+        {
+            return std::uniform_int_distribution<std::uint64_t>{}(rng);
+        }
+    };
+    //2^bits mod z values at the beginning are rejected, the remaining values form complete ranges of z values.
+    const Ordinal threshold {(Ordinal{0} - z) % z};
+    while(true)
+    {
+        Ordinal value {word()};
+        if constexpr(sizeof(Ordinal) > sizeof(std::uint64_t))
+        {
+            //The shift is split, because the branch is compiled for 64 bit Ordinal as well.
+            value = ((value << 32) << 32) | word();
+        }
+        if(value >= threshold)
+        {
+            return value % z;
+        }
+    }
+}
+
+template<class RNG>
+Draw UrnOR::sample(RNG& rng) const
+{
+    URN_COUNT(drawAllocations);
+    Draw result(m_k);
+    unrank(uniformOrdinal(rng, z()), result);
+    return result;
+}
+
+template<class RNG>
+void UrnOR::sample_n(RNG& rng, Ordinal count, std::span<uint> out) const
+{
+    if(m_k > 0 && count > out.size() / m_k)
+    {
+        throwException<std::length_error>("The buffer is too small for the draws.");
+    }
+    const Ordinal draws {z()};
+    for(std::size_t drawCounter {}; drawCounter < static_cast<std::size_t>(count); ++drawCounter)
+    {
+        unrank(uniformOrdinal(rng, draws), out.subspan(drawCounter * m_k, m_k));
+    }
+}
+
 //GenericUrn
 
 template <typename T,bool ORDER,bool REPETITION>
 GenericUrn<T, ORDER, REPETITION>::GenericUrn(uint k, const std::vector<T>& elements):m_urn {static_cast<uint>(elements.size()),k}, 
-                                                                                     m_elements {elements}{}
+                                                                                     m_elements {elements}
+{
+    if constexpr(std::totally_ordered<T>)
+    {
+        m_sortedIndices.resize(m_elements.size());
+        for(uint indexCount {}; indexCount < m_sortedIndices.size(); ++indexCount)
+        {
+            m_sortedIndices[indexCount] = indexCount;
+        }
+        std::stable_sort(m_sortedIndices.begin(), m_sortedIndices.end(), [this](uint left, uint right){ return m_elements[left] < m_elements[right]; });
+    }
+}
                                                                                     
 template <typename T,bool ORDER,bool REPETITION>
 uint GenericUrn<T, ORDER, REPETITION>::n() const 
@@ -267,39 +1045,68 @@ uint GenericUrn<T, ORDER, REPETITION>::k() const
 }
 
 template <typename T,bool ORDER,bool REPETITION>
-uint GenericUrn<T, ORDER, REPETITION>::z() const
+Ordinal GenericUrn<T, ORDER, REPETITION>::z() const
 {
     return m_urn.z();
 }
 
 template <typename T,bool ORDER,bool REPETITION>
-typename GenericUrn<T, ORDER, REPETITION>::Iterator GenericUrn<T, ORDER, REPETITION>::begin()
+typename GenericUrn<T, ORDER, REPETITION>::Iterator GenericUrn<T, ORDER, REPETITION>::begin() const
 {
     return Iterator(this,0,Iterator::Status::valid);
 }
 
 template <typename T,bool ORDER,bool REPETITION>
-typename GenericUrn<T, ORDER, REPETITION>::Iterator GenericUrn<T, ORDER, REPETITION>::end()
+typename GenericUrn<T, ORDER, REPETITION>::Iterator GenericUrn<T, ORDER, REPETITION>::begin(const std::vector<T>& draw) const
+{
+    return Iterator(this,rank(draw),Iterator::Status::valid);
+}
+
+template <typename T,bool ORDER,bool REPETITION>
+typename GenericUrn<T, ORDER, REPETITION>::Iterator GenericUrn<T, ORDER, REPETITION>::end() const
 {
+    if(z() > static_cast<Ordinal>(maxSignedOrdinal))
+    {
+        throwException<std::overflow_error>("The number of draws exceeds the range of the iterator.");
+    }
     return Iterator(this,z(),Iterator::Status::invalidBack);
 }
 
 template <typename T,bool ORDER,bool REPETITION>
-std::reverse_iterator<typename GenericUrn<T,ORDER,REPETITION>::Iterator> GenericUrn<T, ORDER, REPETITION>::rbegin()
+ReverseIterator<typename GenericUrn<T,ORDER,REPETITION>::Iterator> GenericUrn<T, ORDER, REPETITION>::rbegin() const
 {   
-    return std::make_reverse_iterator(end());
+    return ReverseIterator<Iterator>(end());
 }
 
 template <typename T,bool ORDER,bool REPETITION>
-std::reverse_iterator<typename GenericUrn<T,ORDER,REPETITION>::Iterator> GenericUrn<T, ORDER, REPETITION>::rend()
+ReverseIterator<typename GenericUrn<T,ORDER,REPETITION>::Iterator> GenericUrn<T, ORDER, REPETITION>::rend() const
 {
-    return std::make_reverse_iterator(begin());
+    return ReverseIterator<Iterator>(begin());
+}
+
+template <typename T,bool ORDER,bool REPETITION>
+std::ranges::subrange<typename GenericUrn<T,ORDER,REPETITION>::Iterator> GenericUrn<T, ORDER, REPETITION>::shard(const Ordinal& i, const Ordinal& m) const
+{
+    if(i >= m)
+    {
+        throwException<std::domain_error>("There is no shard with this index.");
+    }
+    const Ordinal first {shardBegin(z(), i, m)};
+    const Ordinal last {shardBegin(z(), i + 1, m)};
+    if(last > static_cast<Ordinal>(maxSignedOrdinal))
+    {
+        throwException<std::overflow_error>("The number of draws exceeds the range of the iterator.");
+    }
+    const typename Iterator::Status firstStatus {first < z() ? Iterator::Status::valid : Iterator::Status::invalidBack};
+    const typename Iterator::Status lastStatus {last < z() ? Iterator::Status::valid : Iterator::Status::invalidBack};
+    return {Iterator(this,first,firstStatus), Iterator(this,last,lastStatus)};
 }
 
 template <typename T,bool ORDER,bool REPETITION>
 std::vector<T> GenericUrn<T, ORDER, REPETITION>::to_element(const Draw& draw) const
 {
     std::vector<T> result{};
+    result.reserve(draw.size());
     for(auto i: draw)
     {
         result.push_back(m_elements.at(i));
@@ -308,43 +1115,66 @@ std::vector<T> GenericUrn<T, ORDER, REPETITION>::to_element(const Draw& draw) co
 }
 
 template <typename T,bool ORDER,bool REPETITION>
-auto GenericUrn<T, ORDER, REPETITION>::draw(uint ordinalnumber) const
+Draw GenericUrn<T, ORDER, REPETITION>::to_draw(const std::vector<T>& draw) const
 {
-    return to_element(m_urn.draw(ordinalnumber));
-}
-
-template <typename T,bool ORDER,bool REPETITION>
-auto GenericUrn<T, ORDER, REPETITION>::nextDraw(const std::vector<T>& draw) const
-{   
-    Draw nextDraw {};
-    for(uint posCount {}; posCount < draw.size(); ++posCount)
+    Draw result {};
+    result.reserve(draw.size());
+    if constexpr(std::totally_ordered<T>)
     {
-        for(uint upCount {}; upCount < m_elements.size(); ++upCount)
+        //Equal elements are adjacent in m_sortedIndices, in the order of their indices.
+        for(const T& element: draw)
         {
-            if(draw.at(posCount) == m_elements.at(upCount))
+            auto upCount {std::lower_bound(m_sortedIndices.begin(), m_sortedIndices.end(), element, [this](uint index, const T& value){ return m_elements[index] < value; })};
+            for(; upCount != m_sortedIndices.end() && m_elements[*upCount] == element; ++upCount)
             {
-                nextDraw.push_back(upCount);
+                result.push_back(*upCount);
             }
         }
     }
-    return to_element(m_urn.nextDraw(nextDraw));
-}
-
-template <typename T,bool ORDER,bool REPETITION>
-auto GenericUrn<T, ORDER, REPETITION>::backDraw(const std::vector<T>& draw) const
-{
-    Draw backDraw {};
-    for(uint posCount {}; posCount < draw.size(); ++posCount)
+    else
     {
-        for(uint upCount {}; upCount < m_elements.size(); ++upCount)
+        for(uint posCount {}; posCount < draw.size(); ++posCount)
         {
-            if(draw.at(posCount) == m_elements.at(upCount))
+            for(uint upCount {}; upCount < m_elements.size(); ++upCount)
             {
-                backDraw.push_back(upCount);
+                if(draw.at(posCount) == m_elements.at(upCount))
+                {
+                    result.push_back(upCount);
+                }
             }
         }
     }
-    return to_element(m_urn.backDraw(backDraw));
+    return result;
+}
+
+template <typename T,bool ORDER,bool REPETITION>
+auto GenericUrn<T, ORDER, REPETITION>::draw(Ordinal ordinalnumber) const
+{
+    return to_element(m_urn.draw(ordinalnumber));
+}
+
+template <typename T,bool ORDER,bool REPETITION>
+BasicSmallDraw<T, URN_SMALL_DRAW_CAPACITY> GenericUrn<T, ORDER, REPETITION>::smallDraw(Ordinal ordinalnumber) const requires std::is_trivially_copyable_v<T>
+{
+    const SmallDraw balls {m_urn.smallDraw(ordinalnumber)};
+    BasicSmallDraw<T, URN_SMALL_DRAW_CAPACITY> result(balls.size());
+    for(std::size_t posCount {}; posCount < balls.size(); ++posCount)
+    {
+        result[posCount] = m_elements[balls[posCount]];
+    }
+    return result;
+}
+
+template <typename T,bool ORDER,bool REPETITION>
+auto GenericUrn<T, ORDER, REPETITION>::nextDraw(const std::vector<T>& draw) const
+{   
+    return to_element(m_urn.nextDraw(to_draw(draw)));
+}
+
+template <typename T,bool ORDER,bool REPETITION>
+auto GenericUrn<T, ORDER, REPETITION>::backDraw(const std::vector<T>& draw) const
+{
+    return to_element(m_urn.backDraw(to_draw(draw)));
 }
 
 template <typename T,bool ORDER,bool REPETITION>
@@ -357,4 +1187,72 @@ template <typename T,bool ORDER,bool REPETITION>
 auto GenericUrn<T, ORDER, REPETITION>::lastDraw()
 {
     return to_element(m_urn.lastDraw());
+}
+
+template <typename T,bool ORDER,bool REPETITION>
+Ordinal GenericUrn<T, ORDER, REPETITION>::rank(const std::vector<T>& draw) const
+{
+    return m_urn.rank(to_draw(draw));
+}
+
+template <typename T,bool ORDER,bool REPETITION>
+void GenericUrn<T, ORDER, REPETITION>::fill(Ordinal first, Ordinal count, std::span<T> out, Layout layout) const
+{
+    if(count == 0)
+    {
+        return;
+    }
+    if(first >= z() || count > z() - first)
+    {
+        throwException<std::domain_error>("There is no valid draw for this ordinalnumber.");
+    }
+    if(count > out.size() / k())
+    {
+        throwException<std::length_error>("The buffer is too small for the draws.");
+    }
+
+    const std::size_t drawCount {static_cast<std::size_t>(count)};
+    SmallDraw current(k());
+    const std::span<uint> currentSpan(current.data(), current.size());
+    m_urn.unrank(first, currentSpan);
+    for(std::size_t drawCounter {}; drawCounter < drawCount; ++drawCounter)
+    {
+        if(drawCounter > 0)
+        {
+            m_urn.successor(currentSpan);
+        }
+        for(uint posCount {}; posCount < k(); ++posCount)
+        {
+            const std::size_t index {layout == Layout::rowMajor ? drawCounter * k() + posCount : posCount * drawCount + drawCounter};
+            out[index] = m_elements[current[posCount]];
+        }
+    }
+}
+
+template <typename T,bool ORDER,bool REPETITION>
+template<class RNG>
+std::vector<T> GenericUrn<T, ORDER, REPETITION>::sample(RNG& rng) const
+{
+    return to_element(m_urn.sample(rng));
+}
+
+template <typename T,bool ORDER,bool REPETITION>
+template<class RNG>
+void GenericUrn<T, ORDER, REPETITION>::sample_n(RNG& rng, Ordinal count, std::span<T> out) const
+{
+    if(k() > 0 && count > out.size() / k())
+    {
+        throwException<std::length_error>("The buffer is too small for the draws.");
+    }
+    const Ordinal draws {z()};
+    SmallDraw current(k());
+    const std::span<uint> currentSpan(current.data(), current.size());
+    for(std::size_t drawCounter {}; drawCounter < static_cast<std::size_t>(count); ++drawCounter)
+    {
+        m_urn.unrank(uniformOrdinal(rng, draws), currentSpan);
+        for(uint posCount {}; posCount < k(); ++posCount)
+        {
+            out[drawCounter * k() + posCount] = m_elements[current[posCount]];
+        }
+    }
 }
\ No newline at end of file
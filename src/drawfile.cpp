@@ -0,0 +1,333 @@
+/*!
+ * \file drawfile.cpp
+ * \date October 16, 2026
+ *
+ * Implementation file of the binary draw file
+ */
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "drawfile.hpp"
+
+namespace urn
+{
+    namespace
+    {
+        constexpr std::size_t headerSize {48};      //Bytes of the header.
+        constexpr std::uint8_t fileVersion {1};     //Version byte of the header.
+
+        void putLittleEndian(std::uint8_t* out, Ordinal value, const std::size_t& bytes)
+        {
+            for(std::size_t byteCount {}; byteCount < bytes; ++byteCount)
+            {
+                out[byteCount] = static_cast<std::uint8_t>(value & 0xFF);
+                value >>= 8;
+            }
+        }
+
+        Ordinal getLittleEndian(const std::uint8_t* in, const std::size_t& bytes)
+        {
+            Ordinal value {};
+            for(std::size_t byteCount {bytes}; byteCount > 0; --byteCount)
+            {
+                const std::uint8_t byte {in[byteCount - 1]};
+                if(byteCount > sizeof(Ordinal) && byte != 0)
+                {
+                    throw std::runtime_error("The ordinal number of the draw file exceeds the range of the ordinal type.");
+                }
+                if(byteCount <= sizeof(Ordinal))
+                {
+                    value = (value << 8) | byte;
+                }
+            }
+            return value;
+        }
+
+        uint ballWidth(const uint& n)
+        {
+            if(n <= (1u << 8))
+            {
+                return 1;
+            }
+            return n <= (1u << 16) ? 2 : 4;
+        }
+    }
+
+    //writeDrawFile
+
+    void writeDrawFile(const std::string& path, const UrnOR& urn, Ordinal first, Ordinal count)
+    {
+        if(first > urn.z())
+        {
+            throw std::domain_error("There is no valid draw for this ordinalnumber.");
+        }
+        count = std::min(count, urn.z() - first);
+        const uint width {ballWidth(urn.n())};
+        const uint k {urn.k()};
+
+        std::uint8_t header[headerSize] {'U', 'R', 'N', 'D', fileVersion};
+        header[5] = static_cast<std::uint8_t>((urn.order() ? 1 : 0) | (urn.repetition() ? 2 : 0));
+        header[6] = static_cast<std::uint8_t>(width);
+        putLittleEndian(header + 8, urn.n(), 4);
+        putLittleEndian(header + 12, k, 4);
+        putLittleEndian(header + 16, first, 16);
+        putLittleEndian(header + 32, count, 8);
+
+        std::ofstream file {path, std::ios::binary | std::ios::trunc};
+        if(!file)
+        {
+            throw std::runtime_error("The draw file " + path + " cannot be opened.");
+        }
+        file.write(reinterpret_cast<const char*>(header), headerSize);
+
+        //The rows are collected in a buffer of about 1 MiB.
+        const std::size_t rowSize {static_cast<std::size_t>(k) * width};
+        const std::size_t rowsPerBuffer {rowSize > 0 ? std::max<std::size_t>(1, (1u << 20) / rowSize) : 1};
+        std::vector<std::uint8_t> buffer {};
+        buffer.reserve(rowsPerBuffer * rowSize);
+        auto it {urn.begin() + static_cast<SignedOrdinal>(first)};
+        for(Ordinal drawCount {}; drawCount < count; ++drawCount, ++it)
+        {
+            const std::size_t offset {buffer.size()};
+            buffer.resize(offset + rowSize);
+            const Draw draw {*it};
+            for(uint posCount {}; posCount < k; ++posCount)
+            {
+                putLittleEndian(buffer.data() + offset + static_cast<std::size_t>(posCount) * width, draw[posCount], width);
+            }
+            if(buffer.size() >= rowsPerBuffer * rowSize)
+            {
+                file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+                buffer.clear();
+            }
+        }
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        if(!file.flush())
+        {
+            throw std::runtime_error("The draw file " + path + " cannot be written.");
+        }
+    }
+
+    //DrawView
+
+    DrawView::DrawView(const std::uint8_t* data, uint k, uint width): m_data{ data },
+                                                                      m_k{ k },
+                                                                      m_width{ width }{}
+
+    uint DrawView::size() const
+    {
+        return m_k;
+    }
+
+    uint DrawView::operator[](uint position) const
+    {
+        const std::uint8_t* ball {m_data + static_cast<std::size_t>(position) * m_width};
+        switch(m_width)
+        {
+            case 1: return ball[0];
+            case 2: return static_cast<uint>(ball[0] | (ball[1] << 8));
+            default: return static_cast<uint>(ball[0] | (ball[1] << 8) | (ball[2] << 16)) | (static_cast<uint>(ball[3]) << 24);
+        }
+    }
+
+    Draw DrawView::toDraw() const
+    {
+        Draw draw(m_k);
+        for(uint posCount {}; posCount < m_k; ++posCount)
+        {
+            draw[posCount] = (*this)[posCount];
+        }
+        return draw;
+    }
+
+    //DrawFile::Iterator
+
+    DrawFile::Iterator::Iterator(const DrawFile* file, std::size_t index): m_file{ file },
+                                                                           m_index{ index }{}
+
+    DrawView DrawFile::Iterator::operator*() const
+    {
+        return (*m_file)[m_index];
+    }
+
+    DrawView DrawFile::Iterator::operator[](difference_type n) const
+    {
+        return (*m_file)[static_cast<std::size_t>(static_cast<difference_type>(m_index) + n)];
+    }
+
+    DrawFile::Iterator& DrawFile::Iterator::operator++()
+    {
+        ++m_index;
+        return *this;
+    }
+
+    DrawFile::Iterator DrawFile::Iterator::operator++(int)
+    {
+        auto temp {*this};
+        ++m_index;
+        return temp;
+    }
+
+    DrawFile::Iterator& DrawFile::Iterator::operator--()
+    {
+        --m_index;
+        return *this;
+    }
+
+    DrawFile::Iterator DrawFile::Iterator::operator--(int)
+    {
+        auto temp {*this};
+        --m_index;
+        return temp;
+    }
+
+    DrawFile::Iterator& DrawFile::Iterator::operator+=(difference_type n)
+    {
+        m_index = static_cast<std::size_t>(static_cast<difference_type>(m_index) + n);
+        return *this;
+    }
+
+    DrawFile::Iterator& DrawFile::Iterator::operator-=(difference_type n)
+    {
+        return (*this += -n);
+    }
+
+    DrawFile::Iterator DrawFile::Iterator::operator+(difference_type n) const
+    {
+        auto temp {*this};
+        return (temp += n);
+    }
+
+    DrawFile::Iterator DrawFile::Iterator::operator-(difference_type n) const
+    {
+        auto temp {*this};
+        return (temp -= n);
+    }
+
+    DrawFile::Iterator::difference_type DrawFile::Iterator::operator-(const Iterator& other) const
+    {
+        return static_cast<difference_type>(m_index) - static_cast<difference_type>(other.m_index);
+    }
+
+    bool DrawFile::Iterator::operator==(const Iterator& other) const
+    {
+        return m_index == other.m_index;
+    }
+
+    //DrawFile
+
+    DrawFile::DrawFile(const std::string& path)
+    {
+        const int descriptor {::open(path.c_str(), O_RDONLY)};
+        if(descriptor < 0)
+        {
+            throw std::runtime_error("The draw file " + path + " cannot be opened.");
+        }
+        struct stat status {};
+        if(::fstat(descriptor, &status) != 0 || static_cast<std::size_t>(status.st_size) < headerSize)
+        {
+            ::close(descriptor);
+            throw std::runtime_error("The file " + path + " is not a draw file.");
+        }
+        m_length = static_cast<std::size_t>(status.st_size);
+        void* mapping {::mmap(nullptr, m_length, PROT_READ, MAP_SHARED, descriptor, 0)};
+        ::close(descriptor);
+        if(mapping == MAP_FAILED)
+        {
+            throw std::runtime_error("The draw file " + path + " cannot be mapped.");
+        }
+        m_data = static_cast<const std::uint8_t*>(mapping);
+
+        try
+        {
+            if(m_data[0] != 'U' || m_data[1] != 'R' || m_data[2] != 'N' || m_data[3] != 'D' || m_data[4] != fileVersion || m_data[5] > 3)
+            {
+                throw std::runtime_error("The file " + path + " is not a draw file.");
+            }
+            m_order = (m_data[5] & 1) != 0;
+            m_repetition = (m_data[5] & 2) != 0;
+            m_width = m_data[6];
+            m_n = static_cast<uint>(getLittleEndian(m_data + 8, 4));
+            m_k = static_cast<uint>(getLittleEndian(m_data + 12, 4));
+            m_first = getLittleEndian(m_data + 16, 16);
+            const Ordinal count {getLittleEndian(m_data + 32, 8)};
+            const std::size_t rowSize {static_cast<std::size_t>(m_k) * m_width};
+            const std::size_t rowBytes {m_length - headerSize};
+            const bool sizeMatches {rowSize == 0 ? rowBytes == 0 : rowBytes % rowSize == 0 && rowBytes / rowSize == count};
+            if((m_width != 1 && m_width != 2 && m_width != 4) || !sizeMatches)
+            {
+                throw std::runtime_error("The size of the draw file " + path + " does not match its header.");
+            }
+            m_count = static_cast<std::size_t>(count);
+        }
+        catch(...)
+        {
+            ::munmap(const_cast<std::uint8_t*>(m_data), m_length);
+            throw;
+        }
+    }
+
+    bool DrawFile::order() const
+    {
+        return m_order;
+    }
+
+    bool DrawFile::repetition() const
+    {
+        return m_repetition;
+    }
+
+    uint DrawFile::n() const
+    {
+        return m_n;
+    }
+
+    uint DrawFile::k() const
+    {
+        return m_k;
+    }
+
+    uint DrawFile::width() const
+    {
+        return m_width;
+    }
+
+    Ordinal DrawFile::first() const
+    {
+        return m_first;
+    }
+
+    std::size_t DrawFile::size() const
+    {
+        return m_count;
+    }
+
+    DrawView DrawFile::operator[](std::size_t index) const
+    {
+        return DrawView(m_data + headerSize + index * m_k * m_width, m_k, m_width);
+    }
+
+    DrawFile::Iterator DrawFile::begin() const
+    {
+        return Iterator(this, 0);
+    }
+
+    DrawFile::Iterator DrawFile::end() const
+    {
+        return Iterator(this, m_count);
+    }
+
+    DrawFile::~DrawFile()
+    {
+        ::munmap(const_cast<std::uint8_t*>(m_data), m_length);
+    }
+}
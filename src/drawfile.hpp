@@ -0,0 +1,261 @@
+/*!
+ * \file drawfile.hpp
+ * \date October 16, 2026
+ *
+ * Header file of the binary draw file
+ *
+ * A draw file contains consecutive draws of an urn as rows of fixed width, so draw i is found by a pointer offset.
+ * The file starts with a header of 48 bytes, all numbers are in little endian order:
+ * bytes 0-3 magic "URND", byte 4 version, byte 5 flags order (1) and repetition (2), byte 6 width of a ball in bytes (1, 2 or 4),
+ * byte 7 reserved, bytes 8-11 n, bytes 12-15 k, bytes 16-31 ordinal number of the first draw, bytes 32-39 count, bytes 40-47 reserved.
+ * The header is followed by count rows of k balls of the given width.
+ */
+
+/*!
+ * Include guard for drawfile.hpp
+ */
+#ifndef DRAWFILE_HPP
+#define DRAWFILE_HPP
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+
+#include "urn.hpp"
+
+namespace urn
+{
+    /*!
+     * \brief Writes the draws first to first+count-1 of the urn into a draw file.
+     * The draws are walked with the iterator of the urn. The width of a ball is the smallest of 1, 2 or 4 bytes which holds n-1.
+     * If count exceeds the remaining draws, it is reduced to them. If first is after the end, an std::domain_error is thrown.
+     * If the file cannot be written, an std::runtime_error is thrown.
+     * @param[in] path   Path of the file.
+     * @param[in] urn    The urn, one of the four urn models.
+     * @param[in] first  Ordinal number of the first draw.
+     * @param[in] count  Number of draws, by default all draws from first to the end.
+     */
+    void writeDrawFile(const std::string& path, const UrnOR& urn, Ordinal first = 0, Ordinal count = maxOrdinal);
+
+    /*!
+     * \class DrawView
+     * \brief View of a draw inside a draw file, which reads the balls directly from the mapped file.
+     */
+    class DrawView
+    {
+        public:
+            /*!
+             * \brief Standard constructor for DrawView.
+             */
+            DrawView() = default;
+
+            /*!
+             * \brief Constructor for DrawView.
+             * @param[in] data   Pointer to the first ball of the draw.
+             * @param[in] k      The size of the draw.
+             * @param[in] width  The width of a ball in bytes.
+             */
+            DrawView(const std::uint8_t* data, uint k, uint width);
+
+            /*!
+             * \brief Getter method which returns the size of the draw.
+             * \return k the size of the draw.
+             */
+            uint size() const;
+
+            /*!
+             * \brief Operator for index, the index is not checked.
+             * \return The ball at the given position.
+             */
+            uint operator[](uint position) const;
+
+            /*!
+             * \brief Conversion to a draw.
+             * \return The balls of type Draw.
+             */
+            Draw toDraw() const;
+
+        private:
+            const std::uint8_t* m_data {};  //!< Pointer to the first ball of the draw.
+            uint m_k {};                    //!< The size of the draw.
+            uint m_width {};                //!< The width of a ball in bytes.
+    };
+
+    /*!
+     * \class DrawFile
+     * \brief Read-only draw file, which is mapped into memory with mmap.
+     * The file is a random access range of DrawView. Reading draw i calculates the address of its row and does not calculate the draw.
+     * Several processes can map the same file, the pages are shared by the operating system.
+     */
+    class DrawFile
+    {
+        public:
+            /*!
+             * \class Iterator
+             * \brief Random access iterator over the draws of the file, which returns DrawView by value.
+             */
+            class Iterator
+            {
+                public:
+                    using iterator_category = std::input_iterator_tag;          /*!< Using decleration for the iterator category, the reference is not a real reference.*/
+                    using iterator_concept  = std::random_access_iterator_tag;  /*!< Using decleration for the C++20 iterator concept.*/
+                    using difference_type   = std::ptrdiff_t;                   /*!< Using decleration for the difference type.*/
+                    using value_type        = DrawView;                         /*!< Using decleration for the value type.*/
+                    using reference         = DrawView;                         /*!< Using decleration for the reference, a view is returned by value.*/
+
+                    /*!
+                     * \brief Standard constructor for Iterator.
+                     */
+                    Iterator() = default;
+
+                    /*!
+                     * \brief Constructor for Iterator.
+                     * @param[in] file   The file of the draws.
+                     * @param[in] index  Index of the draw inside the file.
+                     */
+                    Iterator(const DrawFile* file, std::size_t index);
+
+                    /*!
+                     * \brief Operator for dereferencing.
+                     * \return View of the current draw.
+                     */
+                    DrawView operator*() const;
+
+                    /*!
+                     * \brief Operator for index.
+                     * \return View of the draw n positions after the current draw.
+                     */
+                    DrawView operator[](difference_type n) const;
+
+                    /*!
+                     * \brief Operators for incrementation and decrementation.
+                     */
+                    Iterator& operator++();
+                    Iterator operator++(int);
+                    Iterator& operator--();
+                    Iterator operator--(int);
+
+                    /*!
+                     * \brief Operators for jumps.
+                     */
+                    Iterator& operator+=(difference_type n);
+                    Iterator& operator-=(difference_type n);
+                    Iterator operator+(difference_type n) const;
+                    Iterator operator-(difference_type n) const;
+
+                    /*!
+                     * \brief Operator for distance.
+                     * \return Returns the distance between the two iterators.
+                     */
+                    difference_type operator-(const Iterator& other) const;
+
+                    /*!
+                     * \brief Operator for equal to comparison.
+                     */
+                    bool operator==(const Iterator& other) const;
+
+                    /*!
+                     * \brief Operator for three-way comparison.
+                     */
+                    auto operator<=>(const Iterator& other) const { return m_index <=> other.m_index; }
+
+                    /*!
+                     * \brief Operator for addition with the difference in front.
+                     */
+                    friend Iterator operator+(difference_type n, const Iterator& other)
+                    {
+                        return other + n;
+                    }
+
+                private:
+                    const DrawFile* m_file {};  //!< The file of the draws.
+                    std::size_t m_index {};     //!< Index of the draw inside the file.
+            };
+
+            /*!
+             * \brief Constructor for DrawFile.
+             * Maps the file into memory and checks the header and the size of the file.
+             * If the file cannot be opened or mapped, or if it is not a valid draw file, an std::runtime_error is thrown.
+             * @param[in] path  Path of the file.
+             */
+            explicit DrawFile(const std::string& path);
+
+            DrawFile(const DrawFile&) = delete;
+            DrawFile& operator=(const DrawFile&) = delete;
+
+            /*!
+             * \brief Indicates whether the order of the balls is important for the urn model of the draws.
+             */
+            bool order() const;
+
+            /*!
+             * \brief Indicates whether the urn model of the draws contains repetitions.
+             */
+            bool repetition() const;
+
+            /*!
+             * \brief Getter method which returns n.
+             * \return n the number of balls inside the urn.
+             */
+            uint n() const;
+
+            /*!
+             * \brief Getter method which returns k.
+             * \return k the size of a draw.
+             */
+            uint k() const;
+
+            /*!
+             * \brief Getter method which returns the width of a ball.
+             * \return The width of a ball in bytes.
+             */
+            uint width() const;
+
+            /*!
+             * \brief Getter method which returns the ordinal number of the first draw.
+             * \return The ordinal number of the first draw of the file inside the urn.
+             */
+            Ordinal first() const;
+
+            /*!
+             * \brief Getter method which returns the number of draws.
+             * \return The number of draws of the file.
+             */
+            std::size_t size() const;
+
+            /*!
+             * \brief Operator for index, the index is not checked.
+             * \return View of draw index of the file, which is the draw first() + index of the urn.
+             */
+            DrawView operator[](std::size_t index) const;
+
+            /*!
+             * \brief Begin iterator.
+             */
+            Iterator begin() const;
+
+            /*!
+             * \brief End iterator.
+             */
+            Iterator end() const;
+
+            /*!
+             * \brief Destructor for DrawFile.
+             * Unmaps the file.
+             */
+            ~DrawFile();
+
+        private:
+            const std::uint8_t* m_data {};  //!< The mapped file.
+            std::size_t m_length {};        //!< The length of the mapped file in bytes.
+            bool m_order {};                //!< Indicates whether the order is important.
+            bool m_repetition {};           //!< Indicates whether the urn model contains repetitions.
+            uint m_n {};                    //!< The number of balls inside the urn.
+            uint m_k {};                    //!< The size of a draw.
+            uint m_width {};                //!< The width of a ball in bytes.
+            Ordinal m_first {};             //!< The ordinal number of the first draw.
+            std::size_t m_count {};         //!< The number of draws.
+    };
+}
+#endif // DRAWFILE_HPP
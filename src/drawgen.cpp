@@ -0,0 +1,145 @@
+/*!
+ * \file drawgen.cpp
+ * \date October 16, 2026
+ *
+ * Command line generator which writes the draws of an urn to the standard output.
+ *
+ * Usage: drawgen --n N --k K [--order] [--repetition] [--shard I/M] [--from F] [--count C] [--threads T] [--format FORMAT]
+ *
+ * --order, --repetition  Select the urn model, without both flags Urn is used.
+ * --shard I/M            Restricts the draws to shard I of M (see UrnOR::shard()).
+ * --from F               Ordinal number of the first draw, relative to the shard (default 0).
+ * --count C              Number of draws (default all remaining draws).
+ * --threads T            Number of threads which format the draws, 0 selects all cores (default 1).
+ * --format FORMAT        plain, csv, jsonl or count; count only writes the number of selected draws.
+ *
+ * The draws are calculated with fill(), which calculates the first draw of a batch from its ordinal number
+ * and the others with successor(), and written with a Formatter. With several threads, every thread
+ * fills and formats its own batches, and the batches are written in ordinal order.
+ */
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <algorithm>
+
+#include "urn.hpp"
+#include "parallel.hpp"
+#include "format.hpp"
+#include "cli.hpp"
+
+using namespace urn;
+
+namespace
+{
+    constexpr std::size_t batchSize {4096};    //Number of draws of a batch.
+
+    void printUsage()
+    {
+        std::cerr << "Usage: drawgen --n N --k K [--order] [--repetition] [--shard I/M] [--from F] [--count C] [--threads T] [--format plain|csv|jsonl|count]\n";
+    }
+
+    Formatter makeFormatter(const DrawgenOptions& options)
+    {
+        if(options.format == "csv")
+        {
+            return Formatter{options.n, Format::csv};
+        }
+        if(options.format == "jsonl")
+        {
+            return Formatter{options.n, Format::jsonLines};
+        }
+        return Formatter{options.n, Format::plain};
+    }
+
+    void writeOutput(const char* data, std::size_t size)
+    {
+        if(std::fwrite(data, 1, size, stdout) != size)
+        {
+            throw std::runtime_error("The output could not be written.");
+        }
+    }
+
+    /*
+     * Writes the draws first to first+count-1 of urn. Every task fills and formats one batch,
+     * one run of the pool formats one batch per worker, which are written in ordinal order.
+     */
+    void writeDraws(const UrnOR& urn, const Formatter& formatter, ThreadPool& pool, const Ordinal& first, const Ordinal& count)
+    {
+        const uint k {urn.k()};
+        if(k == 0)
+        {
+            const std::string empty {formatter.toString(std::span<const uint>{})};
+            for(Ordinal drawCount {}; drawCount < count; ++drawCount)
+            {
+                writeOutput(empty.data(), empty.size());
+            }
+            return;
+        }
+
+        const std::size_t tasks {pool.size()};
+        std::vector<std::vector<uint>> balls(tasks, std::vector<uint>(batchSize * k));
+        std::vector<std::vector<char>> texts(tasks, std::vector<char>(batchSize * formatter.maxSize(k)));
+        std::vector<std::size_t> sizes(tasks);
+        for(Ordinal done {}; done < count;)
+        {
+            const Ordinal runFirst {first + done};
+            const Ordinal runCount {std::min(count - done, static_cast<Ordinal>(tasks * batchSize))};
+            const std::size_t runTasks {static_cast<std::size_t>((runCount + batchSize - 1) / batchSize)};
+            pool.run(runTasks, [&](std::size_t task)
+            {
+                const Ordinal taskFirst {static_cast<Ordinal>(task) * batchSize};
+                const Ordinal taskCount {std::min(runCount - taskFirst, static_cast<Ordinal>(batchSize))};
+                urn.fill(runFirst + taskFirst, taskCount, balls[task]);
+                const std::span<const uint> draws {balls[task].data(), static_cast<std::size_t>(taskCount) * k};
+                sizes[task] = formatter.write(draws, k, texts[task]).bytes;
+            });
+            for(std::size_t task {}; task < runTasks; ++task)
+            {
+                writeOutput(texts[task].data(), sizes[task]);
+            }
+            done += runCount;
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        const DrawgenOptions options {parseDrawgenOptions(std::vector<std::string>(argv + 1, argv + argc))};
+        const std::unique_ptr<UrnOR> urn {makeUrn(options)};
+        const DrawSelection selection {selectDraws(options, urn->z())};
+
+        if(options.format == "count")
+        {
+            std::cout << ordinalToString(selection.count) << '\n' << std::flush;
+            if(!std::cout)
+            {
+                throw std::runtime_error("The output could not be written.");
+            }
+            return 0;
+        }
+        ThreadPool pool {options.threads};
+        writeDraws(*urn, makeFormatter(options), pool, selection.first, selection.count);
+        if(std::fflush(stdout) != 0 || std::ferror(stdout))
+        {
+            throw std::runtime_error("The output could not be written.");
+        }
+    }
+    catch(const std::invalid_argument& exception)
+    {
+        std::cerr << "drawgen: " << exception.what() << '\n';
+        printUsage();
+        return 1;
+    }
+    catch(const std::exception& exception)
+    {
+        std::cerr << "drawgen: " << exception.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
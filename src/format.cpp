@@ -0,0 +1,133 @@
+/*!
+ * \file format.cpp
+ * \date October 16, 2026
+ *
+ * Implementation file of the text formatter for draws
+ */
+
+#include <vector>
+#include <string>
+#include <span>
+#include <charconv>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+#include "format.hpp"
+
+namespace urn
+{
+    //Formatter
+
+    Formatter::Formatter(uint n, Format format)
+    {
+        switch(format)
+        {
+            case Format::plain: *this = Formatter(n, " ", "\n"); break;
+            case Format::csv: *this = Formatter(n, ",", "\n"); break;
+            case Format::jsonLines: *this = Formatter(n, ",", "\n", "[", "]"); break;
+            default: throw std::invalid_argument("format is invalid."); break;
+        }
+    }
+
+    Formatter::Formatter(uint n, const std::string& separator, const std::string& terminator, const std::string& prefix, const std::string& suffix): m_separator{ separator },
+                                                                                                                                                       m_terminator{ terminator },
+                                                                                                                                                       m_prefix{ prefix },
+                                                                                                                                                       m_suffix{ suffix }
+    {
+        //An entry contains the digits of a ball followed by the separator, if both fit into digitStride bytes.
+        const uint tableSize {maxDigits + separator.size() <= digitStride ? std::min(n, tableLimit) : 0};
+        m_digits.resize(static_cast<std::size_t>(tableSize) * digitStride);
+        m_lengths.resize(tableSize);
+        for(uint ball {}; ball < tableSize; ++ball)
+        {
+            char* first {m_digits.data() + static_cast<std::size_t>(ball) * digitStride};
+            char* last {std::to_chars(first, first + maxDigits, ball).ptr};
+            std::memcpy(last, separator.data(), separator.size());
+            m_lengths[ball] = static_cast<unsigned char>(last - first);
+        }
+    }
+
+    std::size_t Formatter::maxSize(uint k) const
+    {
+        const std::size_t separators {k > 0 ? k - 1 : 0};
+        return m_prefix.size() + k * maxDigits + separators * m_separator.size() + m_suffix.size() + m_terminator.size();
+    }
+
+    std::size_t Formatter::writeDraw(std::span<const uint> draw, char* out) const
+    {
+        char* position {out};
+        auto append = [&position](const std::string& text)
+        {
+            std::memcpy(position, text.data(), text.size());
+            position += text.size();
+        };
+
+        append(m_prefix);
+        for(std::size_t posCount {}; posCount < draw.size(); ++posCount)
+        {
+            const uint ball {draw[posCount]};
+            const bool last {posCount + 1 == draw.size()};
+            if(ball < m_lengths.size())
+            {
+                //The entry is copied with a fixed size, the separator is skipped after the last ball.
+                std::memcpy(position, m_digits.data() + static_cast<std::size_t>(ball) * digitStride, digitStride);
+                position += m_lengths[ball] + (last ? 0 : m_separator.size());
+            }
+            else
+            {
+                position = std::to_chars(position, position + maxDigits, ball).ptr;
+                if(!last)
+                {
+                    append(m_separator);
+                }
+            }
+        }
+        append(m_suffix);
+        append(m_terminator);
+        return static_cast<std::size_t>(position - out);
+    }
+
+    FormatResult Formatter::write(std::span<const uint> draws, uint k, std::span<char> out) const
+    {
+        if(k == 0 ? !draws.empty() : draws.size() % k != 0)
+        {
+            throw std::length_error("The size of the draws is not a multiple of k.");
+        }
+        FormatResult result {};
+        if(k == 0)
+        {
+            return result;
+        }
+        const std::size_t drawCount {draws.size() / k};
+        const std::size_t largest {maxSize(k) + digitStride};
+        std::string last {};
+        for(; result.draws < drawCount; ++result.draws)
+        {
+            const auto draw {draws.subspan(result.draws * k, k)};
+            const std::size_t remaining {out.size() - result.bytes};
+            if(remaining >= largest)
+            {
+                result.bytes += writeDraw(draw, out.data() + result.bytes);
+                continue;
+            }
+            //Near the end of out the draw is formatted separately and only copied if it fits.
+            last.resize(largest);
+            const std::size_t size {writeDraw(draw, last.data())};
+            if(size > remaining)
+            {
+                break;
+            }
+            std::memcpy(out.data() + result.bytes, last.data(), size);
+            result.bytes += size;
+        }
+        return result;
+    }
+
+    std::string Formatter::toString(std::span<const uint> draw) const
+    {
+        std::string text(maxSize(static_cast<uint>(draw.size())) + digitStride, '\0');
+        text.resize(writeDraw(draw, text.data()));
+        return text;
+    }
+}
@@ -0,0 +1,120 @@
+/*!
+ * \file format.hpp
+ * \date October 16, 2026
+ *
+ * Header file of the text formatter for draws
+ *
+ * A Formatter writes batches of draws, e.g. from UrnOR::fill() or UrnOR::sample_n(), into a byte buffer.
+ * The decimal representations of the balls 0 to n-1 are calculated once in the constructor,
+ * so writing a draw only copies bytes.
+ */
+
+/*!
+ * Include guard for format.hpp
+ */
+#ifndef FORMAT_HPP
+#define FORMAT_HPP
+
+#include <vector>
+#include <string>
+#include <span>
+#include <cstddef>
+
+#include "urn.hpp"
+
+namespace urn
+{
+    /*!
+     * \enum enum class Format
+     * \brief Predefined text formats of a draw.
+     * plain: "0 1 2\n"
+     * csv: "0,1,2\n"
+     * jsonLines: "[0,1,2]\n"
+     */
+    enum class Format
+    {
+        plain,
+        csv,
+        jsonLines
+    };
+
+    /*!
+     * \struct FormatResult
+     * \brief Result of Formatter::write().
+     */
+    struct FormatResult
+    {
+        std::size_t draws {};   //!< The number of draws which have been written completely.
+        std::size_t bytes {};   //!< The number of bytes which have been written.
+    };
+
+    /*!
+     * \class Formatter
+     * \brief Writes draws as text into a byte buffer.
+     * A draw is written as prefix, the balls separated by the separator, suffix and terminator.
+     */
+    class Formatter
+    {
+        public:
+            /*!
+             * \brief Constructor for Formatter with a predefined format.
+             * @param[in] n       The number of balls inside the urn, the balls 0 to n-1 are formatted with a table.
+             * @param[in] format  The format of a draw.
+             */
+            explicit Formatter(uint n, Format format = Format::plain);
+
+            /*!
+             * \brief Constructor for Formatter with user defined separators.
+             * @param[in] n           The number of balls inside the urn, the balls 0 to n-1 are formatted with a table.
+             * @param[in] separator   Text between two balls.
+             * @param[in] terminator  Text after every draw, e.g. "\n" or "\r\n".
+             * @param[in] prefix      Text before every draw.
+             * @param[in] suffix      Text between the last ball and the terminator.
+             */
+            Formatter(uint n, const std::string& separator, const std::string& terminator, const std::string& prefix = "", const std::string& suffix = "");
+
+            /*!
+             * \brief Calculates the largest number of bytes of a draw of size k.
+             * If a buffer provides at least this number of bytes, the next draw always fits.
+             * \return The largest number of bytes of a draw.
+             */
+            std::size_t maxSize(uint k) const;
+
+            /*!
+             * \brief Writes consecutive draws of size k into out.
+             * Only complete draws are written. If out is full, the remaining draws are not written,
+             * so a caller can flush out and continue with the draw FormatResult::draws.
+             * @param[in] draws  The balls of the draws one after another (Layout::rowMajor), the size must be a multiple of k.
+             * @param[in] k      The size of a draw.
+             * @param[out] out   Buffer which receives the text.
+             * \return The number of draws and bytes which have been written.
+             */
+            FormatResult write(std::span<const uint> draws, uint k, std::span<char> out) const;
+
+            /*!
+             * \brief Converts a single draw to its text.
+             * \return The text of the draw including the terminator.
+             */
+            std::string toString(std::span<const uint> draw) const;
+
+        protected:
+            /*!
+             * \brief Writes a single draw into out, which must provide maxSize(draw.size()) + digitStride bytes,
+             * because the balls are copied with a fixed size.
+             * \return The number of bytes which have been written.
+             */
+            std::size_t writeDraw(std::span<const uint> draw, char* out) const;
+
+            static constexpr std::size_t digitStride {16};  //!< Bytes of a ball and the separator in the digit table.
+            static constexpr uint tableLimit {1u << 16};    //!< Largest n for which a digit table is calculated.
+            static constexpr std::size_t maxDigits {10};    //!< Largest number of digits of a uint.
+
+            std::vector<char> m_digits;             //!< Decimal digits and separator of the balls 0 to n-1 with a stride of digitStride.
+            std::vector<unsigned char> m_lengths;   //!< Number of digits of the balls 0 to n-1.
+            std::string m_separator;                //!< Text between two balls.
+            std::string m_terminator;               //!< Text after every draw.
+            std::string m_prefix;                   //!< Text before every draw.
+            std::string m_suffix;                   //!< Text between the last ball and the terminator.
+    };
+}
+#endif // FORMAT_HPP
@@ -0,0 +1,188 @@
+/*!
+ * \file parallel.cpp
+ * \date October 16, 2026
+ *
+ * Implementation file of the parallel algorithms over the draws of an urn
+ *
+ * Implementation of the thread pool with work stealing.
+ */
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <algorithm>
+
+#include "parallel.hpp"
+
+namespace urn
+{
+    //ThreadPool
+
+    ThreadPool::ThreadPool(uint threads)
+    {
+        if(threads == 0)
+        {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        for(uint workerCount {}; workerCount < threads; ++workerCount)
+        {
+            m_ranges.push_back(std::make_unique<Range>());
+        }
+        for(uint workerCount {}; workerCount < threads; ++workerCount)
+        {
+            m_threads.emplace_back(&ThreadPool::work, this, workerCount);
+        }
+    }
+
+    uint ThreadPool::size() const
+    {
+        return static_cast<uint>(m_threads.size());
+    }
+
+    void ThreadPool::run(std::size_t taskCount, const std::function<void(std::size_t)>& task)
+    {
+        if(taskCount == 0)
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> runLock {m_runMutex};
+        std::unique_lock<std::mutex> lock {m_mutex};
+        //Every worker starts with a contiguous range of tasks.
+        for(uint workerCount {}; workerCount < size(); ++workerCount)
+        {
+            std::lock_guard<std::mutex> rangeLock {m_ranges[workerCount]->mutex};
+            m_ranges[workerCount]->front = taskCount * workerCount / size();
+            m_ranges[workerCount]->back = taskCount * (workerCount + 1) / size();
+        }
+        m_task = &task;
+        m_active = size();
+        m_failed = false;
+        m_exception = nullptr;
+        m_stats = Stats{};
+        ++m_generation;
+        m_start.notify_all();
+        m_done.wait(lock, [this]{ return m_active == 0; });
+        m_task = nullptr;
+        addStats(m_stats);
+        if(m_exception)
+        {
+            std::rethrow_exception(m_exception);
+        }
+    }
+
+    void ThreadPool::work(uint worker)
+    {
+        std::size_t generation {};
+        while(true)
+        {
+            const std::function<void(std::size_t)>* task {};
+            {
+                std::unique_lock<std::mutex> lock {m_mutex};
+                m_start.wait(lock, [&]{ return m_stop || m_generation != generation; });
+                if(m_stop)
+                {
+                    return;
+                }
+                generation = m_generation;
+                task = m_task;
+            }
+
+            std::size_t index {};
+            while(nextTask(worker, index))
+            {
+                try
+                {
+                    (*task)(index);
+                }
+                catch(...)
+                {
+                    std::lock_guard<std::mutex> lock {m_mutex};
+                    if(!m_failed)
+                    {
+                        m_failed = true;
+                        m_exception = std::current_exception();
+                    }
+                }
+            }
+
+            std::lock_guard<std::mutex> lock {m_mutex};
+            //The counters of the worker only contain this run, because they are reset after every run.
+            m_stats += statsSnapshot();
+            resetStats();
+            if(--m_active == 0)
+            {
+                m_done.notify_all();
+            }
+        }
+    }
+
+    bool ThreadPool::nextTask(uint worker, std::size_t& task)
+    {
+        {
+            std::lock_guard<std::mutex> lock {m_mutex};
+            if(m_failed)
+            {
+                return false;
+            }
+        }
+        Range& own {*m_ranges[worker]};
+        {
+            std::lock_guard<std::mutex> lock {own.mutex};
+            if(own.front < own.back)
+            {
+                task = own.front++;
+                return true;
+            }
+        }
+        //Steal the back half of the range of another worker, starting with the next one.
+        for(uint victimCount {1}; victimCount < size(); ++victimCount)
+        {
+            Range& victim {*m_ranges[(worker + victimCount) % size()]};
+            std::size_t front {};
+            std::size_t back {};
+            {
+                std::lock_guard<std::mutex> lock {victim.mutex};
+                if(victim.front == victim.back)
+                {
+                    continue;
+                }
+                front = victim.front + (victim.back - victim.front) / 2;
+                back = victim.back;
+                victim.back = front;
+            }
+            std::lock_guard<std::mutex> lock {own.mutex};
+            task = front;
+            own.front = front + 1;
+            own.back = back;
+            return true;
+        }
+        return false;
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock {m_mutex};
+            m_stop = true;
+        }
+        m_start.notify_all();
+        for(auto& thread: m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    //Helper functions
+
+    Ordinal chunkSize(const Ordinal& z, const Ordinal& grain)
+    {
+        if(grain > 0)
+        {
+            return grain;
+        }
+        return std::max(Ordinal{1024}, z / 4096 + 1);
+    }
+}
@@ -0,0 +1,226 @@
+/*!
+ * \file parallel.hpp
+ * \date October 16, 2026
+ *
+ * Header file of the parallel algorithms over the draws of an urn
+ *
+ * The ordinal numbers 0 to z-1 of an urn are split into chunks of a fixed size.
+ * A chunk starts at begin() + first, which calculates the first draw from its ordinal number,
+ * and walks the following draws with successors.
+ * The chunks are executed by a ThreadPool, idle workers steal chunks from the other workers.
+ * The chunk size only depends on z and the grain, not on the number of threads,
+ * so the result of an associative reduction does not depend on the number of threads.
+ */
+
+/*!
+ * Include guard for parallel.hpp
+ */
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <atomic>
+
+#include "urn.hpp"
+
+namespace urn
+{
+    /*!
+     * \class ThreadPool
+     * \brief Pool of worker threads which executes a number of tasks with work stealing.
+     * The tasks of run() are distributed as contiguous ranges over the workers.
+     * A worker takes its tasks from the front of its range, an idle worker steals the back half of the range of another worker.
+     */
+    class ThreadPool
+    {
+        public:
+            /*!
+             * \brief Constructor for ThreadPool.
+             * Starts the worker threads, which wait for run().
+             * @param[in] threads  The number of worker threads, 0 selects std::thread::hardware_concurrency().
+             */
+            explicit ThreadPool(uint threads = 0);
+
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator=(const ThreadPool&) = delete;
+
+            /*!
+             * \brief Getter method which returns the number of worker threads.
+             * \return The number of worker threads.
+             */
+            uint size() const;
+
+            /*!
+             * \brief Executes task(0) to task(taskCount-1) on the workers and waits until all tasks are finished.
+             * Calls of run() from several threads are executed one after another.
+             * If a task throws an exception, the remaining tasks are skipped and the first exception is rethrown.
+             * The Stats counted by the workers during the run are added to the counters of the calling thread.
+             * @param[in] taskCount  The number of tasks.
+             * @param[in] task       Function which is called with the index of a task.
+             */
+            void run(std::size_t taskCount, const std::function<void(std::size_t)>& task);
+
+            /*!
+             * \brief Destructor for ThreadPool.
+             * Stops and joins the worker threads.
+             */
+            ~ThreadPool();
+
+        protected:
+            /*!
+             * \struct Range
+             * \brief Range of task indices [front, back) of a worker.
+             */
+            struct Range
+            {
+                std::mutex mutex;       //!< Protects front and back.
+                std::size_t front {};   //!< Next task of the worker.
+                std::size_t back {};    //!< End of the tasks of the worker.
+            };
+
+            /*!
+             * \brief Loop of a worker thread.
+             */
+            void work(uint worker);
+
+            /*!
+             * \brief Takes the next task of a worker, steals from the other workers if its range is empty.
+             * \return true if a task was found.
+             */
+            bool nextTask(uint worker, std::size_t& task);
+
+            std::vector<std::thread> m_threads;                 //!< The worker threads.
+            std::vector<std::unique_ptr<Range>> m_ranges;       //!< The ranges of the workers.
+            std::mutex m_runMutex;                              //!< Serializes calls of run().
+            std::mutex m_mutex;                                 //!< Protects the following members.
+            std::condition_variable m_start;                    //!< Signals a new run or the stop to the workers.
+            std::condition_variable m_done;                     //!< Signals the end of a run to run().
+            const std::function<void(std::size_t)>* m_task {}; //!< The task of the current run.
+            std::size_t m_generation {};                        //!< Counts the runs, a worker starts when it changes.
+            uint m_active {};                                   //!< The number of workers which work on the current run.
+            bool m_stop {};                                     //!< Indicates that the workers shall stop.
+            bool m_failed {};                                   //!< Indicates that a task of the current run has thrown.
+            std::exception_ptr m_exception;                     //!< The first exception of the current run.
+            Stats m_stats;                                      //!< The counters of the workers during the current run.
+    };
+
+    /*!
+     * \brief Helper function which calculates the size of the chunks for the draws of an urn.
+     * The size only depends on z and grain, so that the chunks are the same for every number of threads.
+     * @param[in] z      The number of draws.
+     * @param[in] grain  The requested chunk size, 0 selects about z/4096 draws, but at least 1024.
+     * \return The size of the chunks, at least 1.
+     */
+    Ordinal chunkSize(const Ordinal& z, const Ordinal& grain);
+
+    /*!
+     * \brief Calls f for every draw of the urn in parallel.
+     * f is called concurrently with *it of an iterator of the urn (Draw for the urns, std::vector<T> for GenericUrn)
+     * and must be thread safe. The order of the calls is unspecified.
+     * @param[in] pool   The thread pool which executes the chunks.
+     * @param[in] urn    The urn, an urn model or a GenericUrn.
+     * @param[in] f      Function which is called with every draw.
+     * @param[in] grain  The chunk size, 0 selects a default which only depends on z.
+     */
+    template<class URN, class FUNCTION>
+    void parallel_for_each(ThreadPool& pool, const URN& urn, FUNCTION f, Ordinal grain = 0);
+
+    /*!
+     * \brief Calls f for every draw of the urn in parallel on a pool with std::thread::hardware_concurrency() threads.
+     */
+    template<class URN, class FUNCTION>
+    void parallel_for_each(const URN& urn, FUNCTION f);
+
+    /*!
+     * \brief Maps every draw of the urn with map and combines the results with reduce in parallel.
+     * Every chunk reduces its draws in ordinal order, the results of the chunks are reduced in chunk order.
+     * So the result only depends on the grain and is independent of the number of threads if reduce is associative,
+     * even if it is not commutative.
+     * @param[in] pool    The thread pool which executes the chunks.
+     * @param[in] urn     The urn, an urn model or a GenericUrn.
+     * @param[in] init    The initial value, which is the left operand of the first reduction.
+     * @param[in] reduce  Associative function of two values of type VALUE.
+     * @param[in] map     Function which maps a draw to a value of type VALUE.
+     * @param[in] grain   The chunk size, 0 selects a default which only depends on z.
+     * \return The reduction of init and all mapped draws.
+     */
+    template<class URN, class VALUE, class REDUCE, class MAP>
+    VALUE parallel_transform_reduce(ThreadPool& pool, const URN& urn, VALUE init, REDUCE reduce, MAP map, Ordinal grain = 0);
+
+    /*!
+     * \brief Maps and reduces the draws of the urn in parallel on a pool with std::thread::hardware_concurrency() threads.
+     */
+    template<class URN, class VALUE, class REDUCE, class MAP>
+    VALUE parallel_transform_reduce(const URN& urn, VALUE init, REDUCE reduce, MAP map);
+
+    /*!
+     * \brief Searches the draw with the lowest ordinal number for which predicate returns true in parallel.
+     * When a chunk finds a match, the chunks with higher ordinal numbers are cancelled
+     * and stop at their next draw, the chunks with lower ordinal numbers continue.
+     * @param[in] pool       The thread pool which executes the chunks.
+     * @param[in] urn        The urn, an urn model or a GenericUrn.
+     * @param[in] predicate  Thread safe function which is called with a draw and returns bool.
+     * @param[in] grain      The chunk size, 0 selects a default which only depends on z.
+     * \return The ordinal number of the first matching draw, or z() if no draw matches.
+     */
+    template<class URN, class PREDICATE>
+    Ordinal find_first(ThreadPool& pool, const URN& urn, PREDICATE predicate, Ordinal grain = 0);
+
+    /*!
+     * \brief Searches the first matching draw in parallel on a pool with std::thread::hardware_concurrency() threads.
+     */
+    template<class URN, class PREDICATE>
+    Ordinal find_first(const URN& urn, PREDICATE predicate);
+
+    /*!
+     * \brief Searches any draw for which predicate returns true in parallel.
+     * The first match of any thread cancels all chunks.
+     * @param[in] pool       The thread pool which executes the chunks.
+     * @param[in] urn        The urn, an urn model or a GenericUrn.
+     * @param[in] predicate  Thread safe function which is called with a draw and returns bool.
+     * @param[in] grain      The chunk size, 0 selects a default which only depends on z.
+     * \return The ordinal number of a matching draw, or z() if no draw matches.
+     */
+    template<class URN, class PREDICATE>
+    Ordinal find_any(ThreadPool& pool, const URN& urn, PREDICATE predicate, Ordinal grain = 0);
+
+    /*!
+     * \brief Searches any matching draw in parallel on a pool with std::thread::hardware_concurrency() threads.
+     */
+    template<class URN, class PREDICATE>
+    Ordinal find_any(const URN& urn, PREDICATE predicate);
+
+    /*!
+     * \brief Counts the draws for which predicate returns true in parallel.
+     * @param[in] pool       The thread pool which executes the chunks.
+     * @param[in] urn        The urn, an urn model or a GenericUrn.
+     * @param[in] predicate  Thread safe function which is called with a draw and returns bool.
+     * @param[in] grain      The chunk size, 0 selects a default which only depends on z.
+     * \return The number of matching draws.
+     */
+    template<class URN, class PREDICATE>
+    Ordinal count_if(ThreadPool& pool, const URN& urn, PREDICATE predicate, Ordinal grain = 0);
+
+    /*!
+     * \brief Counts the matching draws in parallel on a pool with std::thread::hardware_concurrency() threads.
+     */
+    template<class URN, class PREDICATE>
+    Ordinal count_if(const URN& urn, PREDICATE predicate);
+
+    /*!
+     * Include guard for parallel.tpp
+     * parallel.tpp contains the definitions of the function templates
+     */
+    #if __has_include("parallel.tpp")
+    #include "parallel.tpp"
+    #endif //__has_include
+}
+#endif // PARALLEL_HPP
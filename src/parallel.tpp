@@ -0,0 +1,207 @@
+/*!
+ * \file parallel.tpp
+ * \date October 16, 2026
+ *
+ * File of the definitions of the parallel function templates
+ */
+
+//Chunks
+
+/*
+ * Calls visit(ordinal, draw) for the draws of the chunk with the given index, starting at begin() + first and walking with ++.
+ * Stops as soon as visit returns false.
+ */
+template<class URN, class VISIT>
+void searchChunk(const URN& urn, const Ordinal& size, const std::size_t& chunk, VISIT& visit)
+{
+    const Ordinal first {static_cast<Ordinal>(chunk) * size};
+    const Ordinal count {std::min(size, urn.z() - first)};
+    auto it {urn.begin() + static_cast<SignedOrdinal>(first)};
+    for(Ordinal drawCount {}; drawCount < count; ++drawCount, ++it)
+    {
+        if(!visit(first + drawCount, *it))
+        {
+            return;
+        }
+    }
+}
+
+/*
+ * Calls visit(draw) for all draws of the chunk with the given index.
+ */
+template<class URN, class VISIT>
+void visitChunk(const URN& urn, const Ordinal& size, const std::size_t& chunk, VISIT& visit)
+{
+    auto all = [&](const Ordinal&, const auto& draw)
+    {
+        visit(draw);
+        return true;
+    };
+    searchChunk(urn, size, chunk, all);
+}
+
+/*
+ * Number of chunks of the given size for z draws.
+ */
+inline std::size_t chunkCount(const Ordinal& z, const Ordinal& size)
+{
+    return static_cast<std::size_t>(z / size + (z % size != 0));
+}
+
+//parallel_for_each
+
+template<class URN, class FUNCTION>
+void parallel_for_each(ThreadPool& pool, const URN& urn, FUNCTION f, Ordinal grain)
+{
+    const Ordinal size {chunkSize(urn.z(), grain)};
+    pool.run(chunkCount(urn.z(), size), [&](std::size_t chunk)
+    {
+        visitChunk(urn, size, chunk, f);
+    });
+}
+
+template<class URN, class FUNCTION>
+void parallel_for_each(const URN& urn, FUNCTION f)
+{
+    ThreadPool pool {};
+    parallel_for_each(pool, urn, f);
+}
+
+//parallel_transform_reduce
+
+template<class URN, class VALUE, class REDUCE, class MAP>
+VALUE parallel_transform_reduce(ThreadPool& pool, const URN& urn, VALUE init, REDUCE reduce, MAP map, Ordinal grain)
+{
+    const Ordinal size {chunkSize(urn.z(), grain)};
+    std::vector<std::optional<VALUE>> partials(chunkCount(urn.z(), size));
+    pool.run(partials.size(), [&](std::size_t chunk)
+    {
+        std::optional<VALUE> partial {};
+        auto visit = [&](const auto& draw)
+        {
+            if(partial)
+            {
+                partial = reduce(std::move(*partial), map(draw));
+            }
+            else
+            {
+                partial = map(draw);
+            }
+        };
+        visitChunk(urn, size, chunk, visit);
+        partials[chunk] = std::move(partial);
+    });
+    for(auto& partial: partials)
+    {
+        init = reduce(std::move(init), std::move(*partial));
+    }
+    return init;
+}
+
+template<class URN, class VALUE, class REDUCE, class MAP>
+VALUE parallel_transform_reduce(const URN& urn, VALUE init, REDUCE reduce, MAP map)
+{
+    ThreadPool pool {};
+    return parallel_transform_reduce(pool, urn, std::move(init), reduce, map);
+}
+
+//find_first
+
+template<class URN, class PREDICATE>
+Ordinal find_first(ThreadPool& pool, const URN& urn, PREDICATE predicate, Ordinal grain)
+{
+    const Ordinal size {chunkSize(urn.z(), grain)};
+    const std::size_t chunks {chunkCount(urn.z(), size)};
+    //Lowest chunk with a match, chunks above it are cancelled.
+    std::atomic<std::size_t> bestChunk {chunks};
+    Ordinal best {urn.z()};
+    std::mutex mutex {};
+    pool.run(chunks, [&](std::size_t chunk)
+    {
+        auto visit = [&](const Ordinal& ordinal, const auto& draw)
+        {
+            if(chunk > bestChunk.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+            if(!predicate(draw))
+            {
+                return true;
+            }
+            std::lock_guard<std::mutex> lock {mutex};
+            if(chunk < bestChunk.load(std::memory_order_relaxed))
+            {
+                bestChunk.store(chunk, std::memory_order_relaxed);
+                best = ordinal;
+            }
+            return false;
+        };
+        searchChunk(urn, size, chunk, visit);
+    });
+    return best;
+}
+
+template<class URN, class PREDICATE>
+Ordinal find_first(const URN& urn, PREDICATE predicate)
+{
+    ThreadPool pool {};
+    return find_first(pool, urn, predicate);
+}
+
+//find_any
+
+template<class URN, class PREDICATE>
+Ordinal find_any(ThreadPool& pool, const URN& urn, PREDICATE predicate, Ordinal grain)
+{
+    const Ordinal size {chunkSize(urn.z(), grain)};
+    std::atomic<bool> found {};
+    Ordinal any {urn.z()};
+    std::mutex mutex {};
+    pool.run(chunkCount(urn.z(), size), [&](std::size_t chunk)
+    {
+        auto visit = [&](const Ordinal& ordinal, const auto& draw)
+        {
+            if(found.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+            if(!predicate(draw))
+            {
+                return true;
+            }
+            std::lock_guard<std::mutex> lock {mutex};
+            if(!found.load(std::memory_order_relaxed))
+            {
+                found.store(true, std::memory_order_relaxed);
+                any = ordinal;
+            }
+            return false;
+        };
+        searchChunk(urn, size, chunk, visit);
+    });
+    return any;
+}
+
+template<class URN, class PREDICATE>
+Ordinal find_any(const URN& urn, PREDICATE predicate)
+{
+    ThreadPool pool {};
+    return find_any(pool, urn, predicate);
+}
+
+//count_if
+
+template<class URN, class PREDICATE>
+Ordinal count_if(ThreadPool& pool, const URN& urn, PREDICATE predicate, Ordinal grain)
+{
+    auto sum = [](Ordinal left, Ordinal right){ return left + right; };
+    auto count = [&](const auto& draw){ return static_cast<Ordinal>(predicate(draw) ? 1 : 0); };
+    return parallel_transform_reduce(pool, urn, Ordinal{}, sum, count, grain);
+}
+
+template<class URN, class PREDICATE>
+Ordinal count_if(const URN& urn, PREDICATE predicate)
+{
+    ThreadPool pool {};
+    return count_if(pool, urn, predicate);
+}
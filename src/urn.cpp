@@ -18,6 +18,9 @@
 #include <cmath>
 #include <algorithm>
 #include <iterator>
+#include <cstdint>
+#include <bit>
+#include <sstream>
 
 #include "urn.hpp"
 
@@ -27,24 +30,326 @@ namespace urn
     using Draw = std::vector<uint>;
 
     //Helper functions
-    
-    uint factorial(const uint& n)
+
+    std::string ordinalToString(Ordinal ordinalnumber)
+    {
+        std::string text {};
+        do
+        {
+            text.push_back(static_cast<char>('0' + static_cast<uint>(ordinalnumber % 10)));
+            ordinalnumber /= 10;
+        } while(ordinalnumber > 0);
+        std::reverse(text.begin(), text.end());
+        return text;
+    }
+
+    Ordinal stringToOrdinal(const std::string& text)
     {
-        if(n == 0)
+        if(text.empty())
+        {
+            throwException<std::invalid_argument>("The text is not a decimal number.");
+        }
+        Ordinal ordinalnumber {};
+        for(const char digit: text)
         {
-            return 1;
+            if(digit < '0' || digit > '9')
+            {
+                throwException<std::invalid_argument>("The text is not a decimal number.");
+            }
+            ordinalnumber = checkedAdd(checkedMultiply(ordinalnumber, 10), static_cast<Ordinal>(digit - '0'));
         }
-        return n*factorial(n-1);
+        return ordinalnumber;
     }
 
-    //Iterator
+    Ordinal shardBegin(const Ordinal& z, const Ordinal& i, const Ordinal& m)
+    {
+        //The first z % m shards contain one draw more than the others.
+        return i * (z / m) + std::min(i, z % m);
+    }
+
+    void unrankCombination(const uint& n, Ordinal ordinalnumber, std::span<uint> draw)
+    {
+        const uint k {static_cast<uint>(draw.size())};
+        if(k == 0)
+        {
+            return;
+        }
+        uint value {};
+        uint m {n - 1};                         //Number of balls greater than value.
+        Ordinal count {binomial(m, k - 1)};     //Number of combinations which continue with value at the current position.
+        for(uint posCount {}; posCount < k; ++posCount)
+        {
+            const uint r {k - 1 - posCount};    //Number of positions after the current position.
+            while(ordinalnumber >= count)
+            {
+                ordinalnumber -= count;
+                count = multiplyDivide(count, m - r, m);
+                --m;
+                ++value;
+            }
+            draw[posCount] = value;
+            if(r > 0)
+            {
+                count = multiplyDivide(count, r, m);
+                --m;
+                ++value;
+            }
+        }
+    }
+
+    namespace
+    {
+        /*
+         * Sum of binomial(n-1-c[i], k-i) over the positions i of a valid combination c of k out of n balls, given by ballOf(i).
+         * The ordinal number of the combination is binomial(n, k) - 1 minus this sum.
+         * Like in unrankCombination, the binomial coefficient is carried from one position to the next,
+         * with one step per skipped ball, unless calculating it anew takes fewer steps.
+         */
+        template<typename BallOf>
+        Ordinal combinationComplement(const uint& n, const uint& k, BallOf ballOf)
+        {
+            uint m {n - 1 - ballOf(0)};
+            uint r {k};
+            Ordinal count {binomial(m, r)};     //binomial(m, r) of the current position.
+            Ordinal complement {count};
+            for(uint posCount {1}; posCount < k; ++posCount)
+            {
+                const uint nextM {n - 1 - ballOf(posCount)};
+                count = multiplyDivide(count, r, m);
+                --m;
+                --r;
+                if(m - nextM > r)
+                {
+                    count = binomial(nextM, r);
+                    m = nextM;
+                }
+                for(; m > nextM; --m)
+                {
+                    count = multiplyDivide(count, m - r, m);
+                }
+                complement += count;
+            }
+            return complement;
+        }
+    }
+
+    //Statistics
+
+    Stats& Stats::operator+=(const Stats& other)
+    {
+        unranks += other.unranks;
+        successorSteps += other.successorSteps;
+        rejections += other.rejections;
+        drawAllocations += other.drawAllocations;
+        exceptions += other.exceptions;
+        return *this;
+    }
+
+    Stats statsSnapshot()
+    {
+    #if defined(URN_STATS)
+        return threadStats;
+    #else
+        return Stats{};
+    #endif
+    }
+
+    void resetStats()
+    {
+    #if defined(URN_STATS)
+        threadStats = Stats{};
+    #endif
+    }
+
+    void addStats(const Stats& stats)
+    {
+    #if defined(URN_STATS)
+        threadStats += stats;
+    #else
+        (void)stats;
+    #endif
+    }
+
+    //CounterRng
+
+    namespace
+    {
+        constexpr std::uint64_t goldenGamma {0x9E3779B97F4A7C15};   //Increment of SplitMix64.
+
+        std::uint64_t splitMix(std::uint64_t value)
+        {
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+            return value ^ (value >> 31);
+        }
+    }
+
+    CounterRng::CounterRng(std::uint64_t seed, std::uint64_t stream): m_key { splitMix(splitMix(seed) + (stream + 1) * goldenGamma) }{}
+
+    CounterRng::result_type CounterRng::operator()()
+    {
+        return splitMix(m_key + (++m_counter) * goldenGamma);
+    }
+
+    void CounterRng::discard(std::uint64_t count)
+    {
+        m_counter += count;
+    }
+
+    std::uint64_t CounterRng::counter() const
+    {
+        return m_counter;
+    }
+
+    //Cursor
+
+    namespace
+    {
+        constexpr std::uint8_t cursorVersion {1};       //Version byte of the binary token.
+        constexpr std::size_t cursorOrdinalBytes {16};  //Bytes of the ordinal number in the binary token.
+
+        const char* modelName(const bool& order, const bool& repetition)
+        {
+            if(order)
+            {
+                return repetition ? "UrnOR" : "UrnO";
+            }
+            return repetition ? "UrnR" : "Urn";
+        }
+
+        void writeLittleEndian(std::vector<std::uint8_t>& binary, Ordinal value, const std::size_t& bytes)
+        {
+            for(std::size_t byteCount {}; byteCount < bytes; ++byteCount)
+            {
+                binary.push_back(static_cast<std::uint8_t>(value & 0xFF));
+                value >>= 8;
+            }
+        }
+
+        Ordinal readLittleEndian(std::span<const std::uint8_t> binary, std::size_t& position, const std::size_t& bytes)
+        {
+            if(binary.size() - position < bytes)
+            {
+                throwException<std::invalid_argument>("The binary cursor is too short.");
+            }
+            Ordinal value {};
+            for(std::size_t byteCount {}; byteCount < bytes; ++byteCount)
+            {
+                const std::uint8_t byte {binary[position + byteCount]};
+                if(byteCount >= sizeof(Ordinal))
+                {
+                    if(byte != 0)
+                    {
+                        throwException<std::overflow_error>("The ordinal number of the cursor exceeds the range of the ordinal type.");
+                    }
+                    continue;
+                }
+                value |= static_cast<Ordinal>(byte) << (8 * byteCount);
+            }
+            position += bytes;
+            return value;
+        }
+
+        uint toUint(const Ordinal& value)
+        {
+            if(value > static_cast<Ordinal>(static_cast<uint>(-1)))
+            {
+                throwException<std::invalid_argument>("The value of the cursor exceeds the range of uint.");
+            }
+            return static_cast<uint>(value);
+        }
+    }
+
+    std::string Cursor::toText() const
+    {
+        std::string text {modelName(order, repetition)};
+        text += ' ' + std::to_string(n) + ' ' + std::to_string(k) + ' ' + ordinalToString(ordinal);
+        for(const uint& ball: draw)
+        {
+            text += ' ' + std::to_string(ball);
+        }
+        return text;
+    }
+
+    Cursor Cursor::fromText(const std::string& text)
+    {
+        std::istringstream stream {text};
+        std::vector<std::string> tokens {};
+        for(std::string token {}; stream >> token;)
+        {
+            tokens.push_back(token);
+        }
+        if(tokens.size() < 4)
+        {
+            throwException<std::invalid_argument>("The text cursor is too short.");
+        }
+        Cursor cursor {};
+        const std::string& model {tokens[0]};
+        if(model != "UrnOR" && model != "UrnO" && model != "UrnR" && model != "Urn")
+        {
+            throwException<std::invalid_argument>("The text cursor has an unknown urn model.");
+        }
+        cursor.order = model == "UrnOR" || model == "UrnO";
+        cursor.repetition = model == "UrnOR" || model == "UrnR";
+        cursor.n = toUint(stringToOrdinal(tokens[1]));
+        cursor.k = toUint(stringToOrdinal(tokens[2]));
+        cursor.ordinal = stringToOrdinal(tokens[3]);
+        if(tokens.size() - 4 != cursor.k)
+        {
+            throwException<std::invalid_argument>("The text cursor does not contain k balls.");
+        }
+        for(std::size_t tokenCount {4}; tokenCount < tokens.size(); ++tokenCount)
+        {
+            cursor.draw.push_back(toUint(stringToOrdinal(tokens[tokenCount])));
+        }
+        return cursor;
+    }
+
+    std::vector<std::uint8_t> Cursor::toBinary() const
+    {
+        std::vector<std::uint8_t> binary {'U', 'R', 'N', 'C', cursorVersion};
+        binary.reserve(30 + 4 * draw.size());
+        binary.push_back(static_cast<std::uint8_t>((order ? 1 : 0) | (repetition ? 2 : 0)));
+        writeLittleEndian(binary, n, 4);
+        writeLittleEndian(binary, k, 4);
+        writeLittleEndian(binary, ordinal, cursorOrdinalBytes);
+        for(const uint& ball: draw)
+        {
+            writeLittleEndian(binary, ball, 4);
+        }
+        return binary;
+    }
+
+    Cursor Cursor::fromBinary(std::span<const std::uint8_t> binary)
+    {
+        if(binary.size() < 30 || binary[0] != 'U' || binary[1] != 'R' || binary[2] != 'N' || binary[3] != 'C')
+        {
+            throwException<std::invalid_argument>("The binary cursor has no valid header.");
+        }
+        if(binary[4] != cursorVersion || binary[5] > 3)
+        {
+            throwException<std::invalid_argument>("The binary cursor has an unknown version or flags.");
+        }
+        Cursor cursor {};
+        cursor.order = (binary[5] & 1) != 0;
+        cursor.repetition = (binary[5] & 2) != 0;
+        std::size_t position {6};
+        cursor.n = static_cast<uint>(readLittleEndian(binary, position, 4));
+        cursor.k = static_cast<uint>(readLittleEndian(binary, position, 4));
+        cursor.ordinal = readLittleEndian(binary, position, cursorOrdinalBytes);
+        if((binary.size() - position) / 4 != cursor.k || (binary.size() - position) % 4 != 0)
+        {
+            throwException<std::invalid_argument>("The binary cursor does not contain k balls.");
+        }
+        cursor.draw.resize(cursor.k);
+        for(uint& ball: cursor.draw)
+        {
+            ball = static_cast<uint>(readLittleEndian(binary, position, 4));
+        }
+        return cursor;
+    }
 
-    using iterator_category = std::random_access_iterator_tag;
-    using difference_type   = std::ptrdiff_t;
-    using value_type        = Draw;
-    using pointer           = Draw*;  
-    using reference         = const Draw;
-    using size_type         = std::size_t;
+    //Iterator
 
     enum class UrnOR::Iterator::Status
     {
@@ -53,9 +358,22 @@ namespace urn
         invalidBack
     };
 
-    UrnOR::Iterator::Iterator(const UrnOR* urn, const uint& ordinalnumber, const Status& status): m_urn{ urn },
-                                                                                 m_ordinalnumber{ static_cast<int>(ordinalnumber) },
-                                                                                 m_status { status }{}
+    UrnOR::Iterator::Iterator(const UrnOR* urn, const Ordinal& ordinalnumber, const Status& status): m_urn{ urn },
+                                                                                 m_ordinalnumber{ static_cast<SignedOrdinal>(ordinalnumber) },
+                                                                                 m_status { status },
+                                                                                 m_z { urn->z() }
+    {
+        load();
+    }
+
+    UrnOR::Iterator::Iterator(const UrnOR* urn, const Ordinal& ordinalnumber, const Draw& draw): m_urn{ urn },
+                                                                                 m_ordinalnumber{ static_cast<SignedOrdinal>(ordinalnumber) },
+                                                                                 m_status { Status::valid },
+                                                                                 m_z { urn->z() },
+                                                                                 m_draw { draw }
+    {
+        URN_COUNT(drawAllocations);
+    }
 
     UrnOR::Iterator::Iterator() = default;
 
@@ -66,7 +384,7 @@ namespace urn
             case Status::invalidFront: return "invalidFront"; break;
             case Status::valid: return "valid"; break;
             case Status::invalidBack: return "invalidBack"; break;
-            default: throw std::invalid_argument("m_status is invalid."); break;
+            default: throwException<std::invalid_argument>("m_status is invalid."); break;
         }
     }
 
@@ -80,41 +398,84 @@ namespace urn
         return (*m_urn).k();
     }
 
-    uint UrnOR::Iterator::z() const
+    Ordinal UrnOR::Iterator::z() const
     {
-        return (*m_urn).z();
+        return m_z;
     }
 
-    int UrnOR::Iterator::ordinalnumber() const
+    SignedOrdinal UrnOR::Iterator::ordinalnumber() const
     {
         return m_ordinalnumber;
     }
 
-    const value_type UrnOR::Iterator::operator*() const 
-    {   
-        if(m_ordinalnumber >= z() || m_ordinalnumber < 0)
+    Cursor UrnOR::Iterator::cursor() const
+    {
+        if(m_ordinalnumber < 0 || static_cast<Ordinal>(m_ordinalnumber) > m_z)
+        {
+            throwException<std::domain_error>("There is no cursor for an iterator outside the range.");
+        }
+        return Cursor{(*m_urn).order(), (*m_urn).repetition(), n(), k(), static_cast<Ordinal>(m_ordinalnumber), **this};
+    }
+
+    bool UrnOR::Iterator::inRange() const
+    {
+        return m_ordinalnumber >= 0 && static_cast<Ordinal>(m_ordinalnumber) < m_z;
+    }
+
+    void UrnOR::Iterator::updateStatus()
+    {
+        if(m_ordinalnumber < 0)
+        {
+            m_status = Status::invalidFront;
+        }
+        else if(static_cast<Ordinal>(m_ordinalnumber) >= m_z)
+        {
+            m_status = Status::invalidBack;
+        }
+        else
+        {
+            m_status = Status::valid;
+        }
+    }
+
+    void UrnOR::Iterator::load()
+    {
+        if(m_draw.capacity() < k())
+        {
+            URN_COUNT(drawAllocations);
+        }
+        m_draw.resize(k());
+        if(inRange())
         {
-            return Draw((k()), 0);
+            (*m_urn).unrank(static_cast<Ordinal>(m_ordinalnumber), m_draw);
         }
-        return (*m_urn).draw(m_ordinalnumber);
+        else
+        {
+            std::fill(m_draw.begin(), m_draw.end(), 0);
+        }
+    }
+
+    UrnOR::Iterator::reference UrnOR::Iterator::operator*() const 
+    {   
+        URN_COUNT(drawAllocations);
+        return m_draw;
     }
 
     UrnOR::Iterator& UrnOR::Iterator::operator++()
     {   
+        const bool wasInRange {inRange()};
         ++m_ordinalnumber;
-                    
-        if(m_ordinalnumber == 0)
-        {  
-            m_status = Status::valid;
-        }
-        else if(m_ordinalnumber < 0)
+        updateStatus();
+
+        //Inside the range the draw is advanced in place, otherwise it is calculated from the ordinal number.
+        if(wasInRange && inRange())
         {
-            m_status = Status::invalidFront;
+            (*m_urn).successor(m_draw);
         }
-        else if(m_ordinalnumber >= z())
+        else
         {
-            m_status = Status::invalidBack;
-        }      
+            load();
+        }
         return *this;
     }
                     
@@ -127,18 +488,17 @@ namespace urn
 
     UrnOR::Iterator& UrnOR::Iterator::operator--()
     {   
+        const bool wasInRange {inRange()};
         --m_ordinalnumber;
-        if(m_ordinalnumber == z()-1)
-        {  
-            m_status = Status::valid;
-        }
-        else if(m_ordinalnumber < 0)
+        updateStatus();
+
+        if(wasInRange && inRange())
         {
-            m_status = Status::invalidFront;
+            (*m_urn).predecessor(m_draw);
         }
-        else if(m_ordinalnumber >= z())
+        else
         {
-            m_status = Status::invalidBack;
+            load();
         }
         return *this;
     }
@@ -155,6 +515,11 @@ namespace urn
         return (m_ordinalnumber == other.m_ordinalnumber);
     }   
 
+    bool UrnOR::Iterator::operator== (std::default_sentinel_t) const
+    {
+        return m_ordinalnumber >= 0 && static_cast<Ordinal>(m_ordinalnumber) >= m_z;
+    }
+
     bool UrnOR::Iterator::operator!= (const Iterator& other) const
     {  
         return !(*this == other); 
@@ -182,20 +547,19 @@ namespace urn
 
     UrnOR::Iterator& UrnOR::Iterator::operator+=(const difference_type& other)
     {   
-        if(other >= 0)
+        if(other == 1)
         {
-            for(uint incCount{}; incCount < other; ++incCount)
-            {
-                ++(*this);
-            }
+            return ++(*this);
         }
-        else if(other < 0)
-        {   
-            long int positivOther {other * -1};
-            for(uint decCount{}; decCount < positivOther; ++decCount)
-            {
-                --(*this);
-            }
+        if(other == -1)
+        {
+            return --(*this);
+        }
+        if(other != 0)
+        {
+            m_ordinalnumber += other;
+            updateStatus();
+            load();
         }
         return *this;
     }
@@ -206,14 +570,14 @@ namespace urn
         return (temp += n);
     }
                 
-    UrnOR::Iterator operator+(const difference_type& n, const UrnOR::Iterator& other) 
+    UrnOR::Iterator operator+(const UrnOR::Iterator::difference_type& n, const UrnOR::Iterator& other) 
     {
         return other + n;
     }
                 
     UrnOR::Iterator& UrnOR::Iterator::operator-=(const difference_type& n)
     {
-        long int negativ {n * -1};
+        difference_type negativ {n * -1};
         (*this) += negativ;
         return *this;
     }
@@ -224,18 +588,20 @@ namespace urn
         return (temp -= n);
     }
 
-    difference_type UrnOR::Iterator::operator-(const Iterator& other) const
+    UrnOR::Iterator::difference_type UrnOR::Iterator::operator-(const Iterator& other) const
     { 
         return m_ordinalnumber - other.m_ordinalnumber;
     }
 
-    reference UrnOR::Iterator::operator[](size_type index) const 
+    UrnOR::Iterator::value_type UrnOR::Iterator::operator[](const difference_type& n) const 
     { 
-        if(index >= z() || index < 0)
+        const SignedOrdinal index {m_ordinalnumber + n};
+        if(index < 0 || static_cast<Ordinal>(index) >= m_z)
         {
-            return Draw((k()), 0);
+            URN_COUNT(drawAllocations);
+            return Draw(k(), 0);
         }
-        return (*m_urn).draw(index);
+        return (*m_urn).draw(static_cast<Ordinal>(index));
     }
 
     UrnOR::Iterator::~Iterator() = default;
@@ -247,9 +613,19 @@ namespace urn
     {   
         if (check == 1 && m_n == 0 && m_k > 0)
         {
-            throw std::domain_error("UrnOR with n == 0 and k > 0 is not valid.");
+            throwException<std::domain_error>("UrnOR with n == 0 and k > 0 is not valid.");
+        }
+
+        m_powers.push_back(1);
+        Ordinal currentPower {1};
+        for(uint exponent {1}; exponent <= m_k && m_n > 1; ++exponent)
+        {
+            if(__builtin_mul_overflow(currentPower, m_n, &currentPower))
+            {
+                break;
+            }
+            m_powers.push_back(currentPower);
         }
-            
     }
 
     uint UrnOR::n() const
@@ -262,33 +638,94 @@ namespace urn
         return m_k;
     }
 
-    uint UrnOR::z() const 
+    Ordinal UrnOR::z() const 
     {   
         if(m_k == 0)    
         {
             return 0;
         }
-        return static_cast<uint>(std::pow(m_n,m_k));
+        if(m_n < 2)
+        {
+            return m_n;
+        }
+        if(m_powers.size() <= m_k)
+        {
+            throwException<std::overflow_error>("The number of draws exceeds the range of the ordinal type.");
+        }
+        return m_powers[m_k];
+    }
+
+    bool UrnOR::order() const
+    {
+        return true;
     }
 
-    UrnOR::Iterator UrnOR::begin()
+    bool UrnOR::repetition() const
+    {
+        return true;
+    }
+
+    UrnOR::Iterator UrnOR::begin() const
     {
         return Iterator(this,0,Iterator::Status::valid);
     }
 
-    UrnOR::Iterator UrnOR::end()
+    UrnOR::Iterator UrnOR::begin(const Draw& draw) const
+    {
+        return Iterator(this,rank(draw),draw);
+    }
+
+    UrnOR::Iterator UrnOR::begin(const Cursor& cursor) const
+    {
+        if(cursor.order != order() || cursor.repetition != repetition() || cursor.n != m_n || cursor.k != m_k || cursor.ordinal > z())
+        {
+            throwException<std::domain_error>("The cursor does not belong to this urn.");
+        }
+        if(cursor.ordinal == z())
+        {
+            return end();
+        }
+        if(rank(cursor.draw) != cursor.ordinal)
+        {
+            throwException<std::domain_error>("The draw of the cursor does not match its ordinal number.");
+        }
+        return Iterator(this,cursor.ordinal,cursor.draw);
+    }
+
+    UrnOR::Iterator UrnOR::end() const
     {
+        if(z() > static_cast<Ordinal>(maxSignedOrdinal))
+        {
+            throwException<std::overflow_error>("The number of draws exceeds the range of the iterator.");
+        }
         return Iterator(this,z(),Iterator::Status::invalidBack);
     }
 
-    std::reverse_iterator<UrnOR::Iterator>/*auto*/ UrnOR::rbegin()
+    ReverseIterator<UrnOR::Iterator> UrnOR::rbegin() const
     {   
-        return std::make_reverse_iterator(end());
+        return ReverseIterator<UrnOR::Iterator>(end());
+    }
+
+    ReverseIterator<UrnOR::Iterator> UrnOR::rend() const
+    {
+        return ReverseIterator<UrnOR::Iterator>(begin());
     }
 
-    std::reverse_iterator<UrnOR::Iterator>/*auto*/ UrnOR::rend()
+    std::ranges::subrange<UrnOR::Iterator> UrnOR::shard(const Ordinal& i, const Ordinal& m) const
     {
-        return std::make_reverse_iterator(begin());
+        if(i >= m)
+        {
+            throwException<std::domain_error>("There is no shard with this index.");
+        }
+        const Ordinal first {shardBegin(z(), i, m)};
+        const Ordinal last {shardBegin(z(), i + 1, m)};
+        if(last > static_cast<Ordinal>(maxSignedOrdinal))
+        {
+            throwException<std::overflow_error>("The number of draws exceeds the range of the iterator.");
+        }
+        const Iterator::Status firstStatus {first < z() ? Iterator::Status::valid : Iterator::Status::invalidBack};
+        const Iterator::Status lastStatus {last < z() ? Iterator::Status::valid : Iterator::Status::invalidBack};
+        return {Iterator(this,first,firstStatus), Iterator(this,last,lastStatus)};
     }
 
     [[nodiscard]] bool UrnOR::valid(const Draw& draw) const
@@ -309,71 +746,100 @@ namespace urn
 
     Draw UrnOR::nextDraw(Draw draw) const
     {   
-        if(valid(draw))
-        {        
-            for (uint downCount { m_k }; downCount > 0; --downCount)
-            {
-                if (draw[downCount - 1] < m_n - 1)
-                {   
-                    ++draw[downCount - 1];
-                    for (uint upCount { downCount }; upCount < m_k; ++upCount)
-                    {
-                        draw[upCount] = 0;
-                    }
-                    return draw;
-                }
-            }
+        if(valid(draw) && successor(draw))
+        {
+            return draw;
         }
-        throw std::overflow_error("There is no valid next draw.");
+        throwException<std::overflow_error>("There is no valid next draw.");
     }
 
     Draw UrnOR::backDraw(Draw draw) const
     {   
-        if(valid(draw) && draw != Draw(m_k,0))
+        if(valid(draw) && predecessor(draw))
         {
-            for(uint downCount {m_k}; downCount > 0; --downCount)
-            {
-                if(draw[downCount-1] != 0)
-                {
-                    draw[downCount-1] -= 1;
-                    return draw;
-                }
-                else
-                {
-                    draw[downCount-1] = m_n-1;
-                }
-            }
             return draw;
         }
-        throw std::underflow_error("There is no valid back draw.");
+        throwException<std::underflow_error>("There is no valid back draw.");
     }
 
-    Draw UrnOR::draw(uint ordinalnumber) const
-    {   
-        if(ordinalnumber < 0 || ordinalnumber >= UrnOR::z())
+    bool UrnOR::successor(std::span<uint> draw) const
+    {
+        URN_COUNT(successorSteps);
+        for(uint downCount {m_k}; downCount > 0; --downCount)
         {
-            throw std::domain_error("There is no valid draw for this ordinalnumber.");
+            if(draw[downCount - 1] < m_n - 1)
+            {   
+                ++draw[downCount - 1];
+                for(uint upCount {downCount}; upCount < m_k; ++upCount)
+                {
+                    draw[upCount] = 0;
+                }
+                return true;
+            }
         }
-            
-        Draw draw(m_k, 0);
-        for (int posCount {static_cast<int>(m_k - 1)}; posCount >= 0; --posCount)
+        return false;
+    }
+
+    bool UrnOR::predecessor(std::span<uint> draw) const
+    {
+        URN_COUNT(successorSteps);
+        for(uint downCount {m_k}; downCount > 0; --downCount)
         {
-            for (uint timesCount {m_n - 1}; timesCount >= 1; --timesCount)
+            if(draw[downCount - 1] != 0)
             {
-                if (static_cast<uint>(std::pow(m_n, posCount)) * timesCount <= ordinalnumber)
+                --draw[downCount - 1];
+                for(uint upCount {downCount}; upCount < m_k; ++upCount)
                 {
-                    draw[posCount] = timesCount;
-                    ordinalnumber -= static_cast<uint>(std::pow(m_n, posCount)) * timesCount;
-                    break;
+                    draw[upCount] = m_n - 1;
                 }
+                return true;
             }
         }
-        std::reverse(draw.begin(), draw.end());
-        return draw;
+        return false;
     }
 
-    Draw UrnOR::firstDraw() const
-    {
+    Draw UrnOR::draw(Ordinal ordinalnumber) const
+    {   
+        URN_COUNT(drawAllocations);
+        Draw result(m_k);
+        unrank(ordinalnumber, result);
+        return result;
+    }
+
+    SmallDraw UrnOR::smallDraw(Ordinal ordinalnumber) const
+    {
+        SmallDraw result(m_k);
+        unrank(ordinalnumber, std::span<uint>(result.data(), result.size()));
+        return result;
+    }
+
+    void UrnOR::unrank(Ordinal ordinalnumber, std::span<uint> draw) const
+    {
+        if(ordinalnumber >= z() || draw.size() != m_k)
+        {
+            throwException<std::domain_error>("There is no valid draw for this ordinalnumber.");
+        }
+        URN_COUNT(unranks);
+        unrankDraw(ordinalnumber, draw);
+    }
+
+    void UrnOR::unrankDraw(Ordinal ordinalnumber, std::span<uint> draw) const
+    {
+        if(m_n < 2)
+        {
+            std::fill(draw.begin(), draw.end(), 0);
+            return;
+        }
+        for(uint posCount {}; posCount < m_k; ++posCount)
+        {
+            const Ordinal weight {m_powers[m_k - 1 - posCount]};
+            draw[posCount] = static_cast<uint>(ordinalnumber / weight);
+            ordinalnumber %= weight;
+        }
+    }
+
+    Draw UrnOR::firstDraw() const
+    {
         return draw(0);
     }
 
@@ -382,98 +848,334 @@ namespace urn
         return draw(z()-1);
     }
 
+    Ordinal UrnOR::rank(const Draw& draw) const
+    {
+        return rankDraw(draw);
+    }
+
+    Ordinal UrnOR::rankDraw(std::span<const uint> draw) const
+    {
+        if(draw.size() != m_k || m_k == 0)
+        {
+            throwException<std::domain_error>("There is no valid ordinalnumber for this draw.");
+        }
+        Ordinal result {};
+        for(const uint ball: draw)
+        {
+            if(ball >= m_n)
+            {
+                throwException<std::domain_error>("There is no valid ordinalnumber for this draw.");
+            }
+            result = checkedAdd(checkedMultiply(result, m_n), ball);
+        }
+        return result;
+    }
+
+    void UrnOR::fill(Ordinal first, Ordinal count, std::span<uint> out, Layout layout) const
+    {
+        if(count == 0)
+        {
+            return;
+        }
+        if(first >= z() || count > z() - first)
+        {
+            throwException<std::domain_error>("There is no valid draw for this ordinalnumber.");
+        }
+        if(count > out.size() / m_k)
+        {
+            throwException<std::length_error>("The buffer is too small for the draws.");
+        }
+
+        const std::size_t drawCount {static_cast<std::size_t>(count)};
+        if(layout == Layout::rowMajor)
+        {
+            //Every draw is copied from its predecessor and replaced in place by its successor.
+            unrank(first, out.first(m_k));
+            for(std::size_t drawCounter {1}; drawCounter < drawCount; ++drawCounter)
+            {
+                const auto current {out.subspan(drawCounter * m_k, m_k)};
+                std::copy_n(out.begin() + static_cast<std::ptrdiff_t>((drawCounter - 1) * m_k), m_k, current.begin());
+                successor(current);
+            }
+            return;
+        }
+
+        SmallDraw current(m_k);
+        const std::span<uint> currentSpan(current.data(), current.size());
+        unrank(first, currentSpan);
+        for(std::size_t drawCounter {}; drawCounter < drawCount; ++drawCounter)
+        {
+            if(drawCounter > 0)
+            {
+                successor(currentSpan);
+            }
+            for(uint posCount {}; posCount < m_k; ++posCount)
+            {
+                out[posCount * drawCount + drawCounter] = current[posCount];
+            }
+        }
+    }
+
     UrnOR::~UrnOR() = default;
 
+    //BallSet – bitmap of the balls used by a draw without repetitions.
+
+    namespace
+    {
+        /*
+         * One word per 64 balls, up to 1024 balls are kept inline without allocation.
+         * The free balls next to a given ball are found with countr_zero/countl_zero on whole words.
+         */
+        class BallSet
+        {
+            public:
+                explicit BallSet(uint n): m_n { n },
+                                          m_bits(std::max((n + 63) / 64, 1u), 0)
+                {}
+
+                BallSet(const BallSet&) = delete;
+                BallSet& operator=(const BallSet&) = delete;
+
+                void insert(uint ball)
+                {
+                    m_bits[ball / 64] |= std::uint64_t{1} << (ball % 64);
+                }
+
+                void erase(uint ball)
+                {
+                    m_bits[ball / 64] &= ~(std::uint64_t{1} << (ball % 64));
+                }
+
+                bool contains(uint ball) const
+                {
+                    return (m_bits[ball / 64] >> (ball % 64)) & 1;
+                }
+
+                //Smallest ball >= from which is not in the set, n if there is none.
+                uint nextFree(uint from) const
+                {
+                    if(from >= m_n)
+                    {
+                        return m_n;
+                    }
+                    std::size_t wordCount {from / 64};
+                    std::uint64_t freeBits {~m_bits[wordCount] & (~std::uint64_t{} << (from % 64))};
+                    while(freeBits == 0)
+                    {
+                        if(++wordCount == m_bits.size())
+                        {
+                            return m_n;
+                        }
+                        freeBits = ~m_bits[wordCount];
+                    }
+                    const uint ball {static_cast<uint>(wordCount * 64 + std::countr_zero(freeBits))};
+                    return ball < m_n ? ball : m_n;
+                }
+
+                //Largest ball < below which is not in the set, n if there is none.
+                uint previousFree(uint below) const
+                {
+                    if(below == 0)
+                    {
+                        return m_n;
+                    }
+                    std::size_t wordCount {(below - 1) / 64};
+                    std::uint64_t freeBits {~m_bits[wordCount] & (~std::uint64_t{} >> (63 - (below - 1) % 64))};
+                    while(freeBits == 0)
+                    {
+                        if(wordCount-- == 0)
+                        {
+                            return m_n;
+                        }
+                        freeBits = ~m_bits[wordCount];
+                    }
+                    return static_cast<uint>(wordCount * 64 + 63 - std::countl_zero(freeBits));
+                }
+
+            private:
+                uint m_n;
+                BasicSmallDraw<std::uint64_t, 16> m_bits;
+        };
+    }
+
     //UrnO – urn where the order is important and does not include repetitions.
 
     UrnO::UrnO(uint n,uint k,uint check): UrnOR { n,k,check }
     {   
         if (check == 2 && m_k > m_n)
         {
-            throw std::domain_error("UrnO with k > n is not valid.");
+            throwException<std::domain_error>("UrnO with k > n is not valid.");
         }
     }
 
-    uint UrnO::z() const
+    Ordinal UrnO::z() const
     {   
         if(m_k == 0)
         {
             return 0;
         }
-        return (factorial(m_n)/factorial(m_n-m_k));
+        return fallingFactorial(m_n, m_k);
     }
 
-    Draw UrnO::draw(uint ordinalnumber) const
-    {   
-        if(ordinalnumber < 0 || ordinalnumber >= z())
-        {
-            throw std::domain_error("There is no valid draw for this ordinalnumber.");
-        }
-
-        Draw result;
-        Draw elements;
-        for(uint fillCount {}; fillCount < m_n; ++fillCount)
-        {
-            elements.push_back(fillCount);
-        }
+    bool UrnO::repetition() const
+    {
+        return false;
+    }
 
-        uint currentVariations {z()};
-        uint index {};
+    void UrnO::unrankDraw(Ordinal ordinalnumber, std::span<uint> draw) const
+    {   
+        //The digits of the Lehmer code are the indices among the unused balls.
+        Ordinal currentVariations {z()};
         for(uint upCount{}; upCount < m_k; ++upCount)
         {
             currentVariations /= (m_n-upCount);
-            index = ordinalnumber/currentVariations;
-            result.push_back(elements.at(index));
-            elements.erase(elements.begin()+index);
-            ordinalnumber -= index*currentVariations;
+            draw[upCount] = static_cast<uint>(ordinalnumber/currentVariations);
+            ordinalnumber %= currentVariations;
+        }
+        //From right to left every ball skips the balls used by its left neighbour.
+        for(uint downCount {m_k}; downCount > 1; --downCount)
+        {
+            const uint pos {downCount - 2};
+            for(uint upCount {pos + 1}; upCount < m_k; ++upCount)
+            {
+                if(draw[upCount] >= draw[pos])
+                {
+                    ++draw[upCount];
+                }
+            }
         }
-        return result;
     }
 
     Draw UrnO::nextDraw(Draw draw) const
     {   
-        if(repetitions(draw) || draw == UrnO::draw(z()-1))
+        if(!valid(draw) || repetitions(draw) || !successor(draw))
         {
-            throw std::domain_error("Either the specified draw is incorrect or there is no next valid draw");
+            throwException<std::domain_error>("Either the specified draw is incorrect or there is no next valid draw");
         }
-
-        Draw result {draw};
-        do
-        {
-            result = UrnOR::nextDraw(result);
-        }while (repetitions(result));
-        return result;
+        return draw;
     }
 
     Draw UrnO::backDraw(Draw draw) const
     {
-        if(repetitions(draw) || draw == UrnO::draw(0))
+        if(!valid(draw) || repetitions(draw) || !predecessor(draw))
         {
-            throw std::domain_error("Either the specified draw is incorrect or there is no next valid draw");
+            throwException<std::domain_error>("Either the specified draw is incorrect or there is no next valid draw");
         }
+        return draw;
+    }
 
-        Draw result {draw};
-        do
+    bool UrnO::successor(std::span<uint> draw) const
+    {
+        URN_COUNT(successorSteps);
+        //Lexicographic next k-permutation: the rightmost position which can take a larger unused ball
+        //gets the smallest such ball, the positions behind it get the smallest unused balls in ascending order.
+        BallSet used {m_n};
+        for(auto ball: draw)
         {
-            result = UrnOR::backDraw(result);
-        }while (repetitions(result));
-        return result;
+            used.insert(ball);
+        }
+        for(uint downCount {m_k}; downCount > 0; --downCount)
+        {
+            const uint pos {downCount - 1};
+            used.erase(draw[pos]);
+            const uint ball {used.nextFree(draw[pos] + 1)};
+            if(ball < m_n)
+            {
+                draw[pos] = ball;
+                used.insert(ball);
+                uint nextBall {};
+                for(uint upCount {downCount}; upCount < m_k; ++upCount)
+                {
+                    nextBall = used.nextFree(nextBall);
+                    draw[upCount] = nextBall;
+                    used.insert(nextBall);
+                }
+                return true;
+            }
+        }
+        return false;
     }
 
-    bool UrnO::repetitions(const Draw& repDraw) const
+    bool UrnO::predecessor(std::span<uint> draw) const
     {
-        for (uint outerCount {}; outerCount < m_k - 1; ++outerCount)
+        URN_COUNT(successorSteps);
+        //Mirror image of successor(): the rightmost position which can take a smaller unused ball
+        //gets the largest such ball, the positions behind it get the largest unused balls in descending order.
+        BallSet used {m_n};
+        for(auto ball: draw)
         {
-            for (uint innerCount { outerCount + 1}; innerCount < m_k; ++innerCount)
+            used.insert(ball);
+        }
+        for(uint downCount {m_k}; downCount > 0; --downCount)
+        {
+            const uint pos {downCount - 1};
+            used.erase(draw[pos]);
+            const uint ball {used.previousFree(draw[pos])};
+            if(ball < m_n)
             {
-                if (repDraw[outerCount] == repDraw[innerCount])
+                draw[pos] = ball;
+                used.insert(ball);
+                uint nextBall {m_n};
+                for(uint upCount {downCount}; upCount < m_k; ++upCount)
                 {
-                    return true;
+                    nextBall = used.previousFree(nextBall);
+                    draw[upCount] = nextBall;
+                    used.insert(nextBall);
                 }
+                return true;
             }
         }
         return false;
-    } 
+    }
+
+    bool UrnO::repetitions(std::span<const uint> repDraw) const
+    {
+        BallSet used {m_n};
+        for(auto ball: repDraw)
+        {
+            if(used.contains(ball))
+            {
+                URN_COUNT(rejections);
+                return true;
+            }
+            used.insert(ball);
+        }
+        return false;
+    }
+
+    Ordinal UrnO::rankDraw(std::span<const uint> draw) const
+    {
+        if(draw.size() != m_k || m_k == 0)
+        {
+            throwException<std::domain_error>("There is no valid ordinalnumber for this draw.");
+        }
+        Draw sortedBalls(draw.begin(), draw.end());
+        std::sort(sortedBalls.begin(), sortedBalls.end());
+        if(sortedBalls.back() >= m_n || std::adjacent_find(sortedBalls.begin(), sortedBalls.end()) != sortedBalls.end())
+        {
+            throwException<std::domain_error>("There is no valid ordinalnumber for this draw.");
+        }
+        //The Lehmer code digit of a position is the number of unused balls smaller than the ball at this position.
+        //The used balls are counted by a Fenwick tree over the positions of the balls in sortedBalls.
+        std::vector<uint> usedCounts(m_k + 1, 0);
+        Ordinal result {};
+        for(uint posCount {}; posCount < m_k; ++posCount)
+        {
+            const uint ball {draw[posCount]};
+            const uint sortedPos {static_cast<uint>(std::lower_bound(sortedBalls.begin(), sortedBalls.end(), ball) - sortedBalls.begin())};
+            uint usedSmaller {};
+            for(uint treeCount {sortedPos}; treeCount > 0; treeCount &= treeCount - 1)
+            {
+                usedSmaller += usedCounts[treeCount];
+            }
+            result = checkedAdd(checkedMultiply(result, m_n - posCount), ball - usedSmaller);
+            for(uint treeCount {sortedPos + 1}; treeCount <= m_k; treeCount += treeCount & (0u - treeCount))
+            {
+                ++usedCounts[treeCount];
+            }
+        }
+        return result;
+    }
 
     //UrnR – urn with unimportant order and with repetitions.   
 
@@ -481,152 +1183,464 @@ namespace urn
     { 
         if (check == 3 && m_n == 0)
         {
-            throw std::domain_error("UrnR with n = 0 is not valid.");
+            throwException<std::domain_error>("UrnR with n = 0 is not valid.");
         }
     }
 
-    uint UrnR::z() const
+    Ordinal UrnR::z() const
     {   
             
         if(m_k == 0)
         {
             return 0;
         }
-        return ((factorial(m_k+m_n-1))/(factorial(m_k)*factorial(m_n-1)));
+        return binomial(m_k+m_n-1, m_k);
+    }
+
+    bool UrnR::order() const
+    {
+        return false;
     }
         
-    Draw UrnR::draw(uint ordinalnumber) const
+    void UrnR::unrankDraw(Ordinal ordinalnumber, std::span<uint> draw) const
     {   
-        if(ordinalnumber < 0 || ordinalnumber >= z())
+        //Stars and bars: a nondecreasing draw d corresponds to the strictly increasing combination d[i]+i out of n+k-1 balls.
+        unrankCombination(m_n + m_k - 1, ordinalnumber, draw);
+        for(uint posCount {}; posCount < m_k; ++posCount)
         {
-            throw std::domain_error("There is no valid draw for this ordinalnumber.");
+            draw[posCount] -= posCount;
         }
-            
-        Draw result {};
-        int unsortedCount {-1};
-        for(uint upCount {}; upCount < UrnOR::z(); ++upCount)
-        {   
-            result = UrnOR::draw(upCount);
-            if(!unsorted(result))
-            {   
-                ++unsortedCount;
-                if(unsortedCount == ordinalnumber)
-                {
-                    break;
-                }
-            }
-        }
-        return result;
     }
 
     Draw UrnR::nextDraw(Draw draw) const
     {   
-        if(unsorted(draw) || draw == UrnR::draw(z()-1))
+        if(!valid(draw) || unsorted(draw) || !successor(draw))
         {
-            throw std::domain_error("Either the specified draw is incorrect or there is no next valid draw");
+            throwException<std::domain_error>("Either the specified draw is incorrect or there is no next valid draw");
         }
+        return draw;
+    }
 
-        Draw result {draw};
-        do
+    Draw UrnR::backDraw(Draw draw) const
+    {
+        if(!valid(draw) || unsorted(draw) || !predecessor(draw))
         {
-            result = UrnOR::nextDraw(result);
-        }while (unsorted(result));
-        return result;
+            throwException<std::domain_error>("Either the specified draw is incorrect or there is no next valid draw");
+        }
+        return draw;
     }
 
-    Draw UrnR::backDraw(Draw draw) const
+    bool UrnR::successor(std::span<uint> draw) const
     {
-        if(unsorted(draw) || draw == UrnR::draw(0))
+        URN_COUNT(successorSteps);
+        //The rightmost ball below n-1 is incremented and the balls behind it take its new value.
+        for(uint downCount {m_k}; downCount > 0; --downCount)
         {
-            throw std::domain_error("Either the specified draw is incorrect or there is no next valid draw");
+            const uint pos {downCount - 1};
+            if(draw[pos] < m_n - 1)
+            {
+                const uint ball {draw[pos] + 1};
+                for(uint upCount {pos}; upCount < m_k; ++upCount)
+                {
+                    draw[upCount] = ball;
+                }
+                return true;
+            }
         }
+        return false;
+    }
 
-        Draw result {draw};
-        do
+    bool UrnR::predecessor(std::span<uint> draw) const
+    {
+        URN_COUNT(successorSteps);
+        //The rightmost ball above its left neighbour is decremented and the balls behind it are set to n-1.
+        for(uint downCount {m_k}; downCount > 0; --downCount)
         {
-            result = UrnOR::backDraw(result);
-        }while (unsorted(result));
-        return result;
+            const uint pos {downCount - 1};
+            if(draw[pos] > (pos == 0 ? 0 : draw[pos - 1]))
+            {
+                --draw[pos];
+                for(uint upCount {downCount}; upCount < m_k; ++upCount)
+                {
+                    draw[upCount] = m_n - 1;
+                }
+                return true;
+            }
+        }
+        return false;
     }
 
-    bool UrnR::unsorted(const Draw& unsortDraw) const
+    bool UrnR::unsorted(std::span<const uint> unsortDraw) const
     {
-        for (uint posCount {}; posCount < m_k - 1; ++posCount)
+        for (uint posCount {}; posCount + 1 < unsortDraw.size(); ++posCount)
         {
             if (unsortDraw[posCount] > unsortDraw[posCount + 1])
             {
+                URN_COUNT(rejections);
                 return true;
             }
         }
         return false;
     }
 
+    Ordinal UrnR::rankDraw(std::span<const uint> draw) const
+    {
+        if(draw.size() != m_k || m_k == 0)
+        {
+            throwException<std::domain_error>("There is no valid ordinalnumber for this draw.");
+        }
+        for(uint posCount {}; posCount < m_k; ++posCount)
+        {
+            if(draw[posCount] >= m_n || (posCount > 0 && draw[posCount] < draw[posCount - 1]))
+            {
+                throwException<std::domain_error>("There is no valid ordinalnumber for this draw.");
+            }
+        }
+        //The draw d corresponds to the combination d[i]+i of k out of n+k-1 balls.
+        return z() - 1 - combinationComplement(m_n + m_k - 1, m_k, [draw](uint posCount) { return draw[posCount] + posCount; });
+    }
+
     //Urn – urn with unimportant order and without repetitions.
 
     Urn::Urn(uint n,uint k,uint check):UrnOR { n,k },
                                        UrnO { n,k,1 },
                                        UrnR { n,k,1 }{}
 
-    uint Urn::z() const
+    Ordinal Urn::z() const
     {   
         if(m_k == 0)
         {
             return 0;
         }
-        return ((factorial(m_n))/(factorial(m_n-m_k)*factorial(m_k)));
+        return binomial(m_n, m_k);
     }
 
-    Draw Urn::draw(uint ordinalnumber) const
+    bool Urn::order() const
     {
-        if(ordinalnumber < 0 || ordinalnumber >= z())
+        return false;
+    }
+
+    bool Urn::repetition() const
+    {
+        return false;
+    }
+
+    void Urn::unrankDraw(Ordinal ordinalnumber, std::span<uint> draw) const
+    {
+        unrankCombination(m_n, ordinalnumber, draw);
+    }
+
+    Draw Urn::nextDraw(Draw draw) const
+    {   
+        if(!valid(draw) || repetitions(draw) || unsorted(draw) || !successor(draw))
         {
-            throw std::domain_error("There is no valid draw for this ordinalnumber.");
+            throwException<std::domain_error>("Either the specified draw is incorrect or there is no next valid draw");
         }
-            
-        Draw result {};
-        int drawCount {-1};
-        for(uint upCount {}; upCount < UrnOR::z(); ++upCount)
-        {   
-            result = UrnOR::draw(upCount);
-            if(!unsorted(result) && !repetitions(result))
-            {   
-                ++drawCount;
-                if(drawCount == ordinalnumber)
+        return draw;
+    }
+
+    Draw Urn::backDraw(Draw draw) const
+    {
+        if(!valid(draw) || repetitions(draw) || unsorted(draw) || !predecessor(draw))
+        {
+            throwException<std::domain_error>("Either the specified draw is incorrect or there is no next valid draw");
+        }
+        return draw;
+    }
+
+    bool Urn::successor(std::span<uint> draw) const
+    {
+        URN_COUNT(successorSteps);
+        //The rightmost ball which is not at its largest possible value is incremented,
+        //the balls behind it follow with distance one.
+        for(uint downCount {m_k}; downCount > 0; --downCount)
+        {
+            const uint pos {downCount - 1};
+            if(draw[pos] < m_n - m_k + pos)
+            {
+                ++draw[pos];
+                for(uint upCount {downCount}; upCount < m_k; ++upCount)
                 {
-                    break;
+                    draw[upCount] = draw[upCount - 1] + 1;
                 }
+                return true;
             }
         }
-        return result;
+        return false;
     }
 
-    Draw Urn::nextDraw(Draw draw) const
-    {   
-        if(repetitions(draw) || unsorted(draw) || draw == Urn::draw(z()-1))
+    bool Urn::predecessor(std::span<uint> draw) const
+    {
+        URN_COUNT(successorSteps);
+        //The rightmost ball which can be decremented without reaching its left neighbour is decremented,
+        //the balls behind it are set to their largest possible values.
+        for(uint downCount {m_k}; downCount > 0; --downCount)
         {
-            throw std::domain_error("Either the specified draw is incorrect or there is no next valid draw");
+            const uint pos {downCount - 1};
+            if(draw[pos] > (pos == 0 ? 0 : draw[pos - 1] + 1))
+            {
+                --draw[pos];
+                for(uint upCount {downCount}; upCount < m_k; ++upCount)
+                {
+                    draw[upCount] = m_n - m_k + upCount;
+                }
+                return true;
+            }
         }
+        return false;
+    }
 
-        Draw result {draw};
-        do
+    Ordinal Urn::rankDraw(std::span<const uint> draw) const
+    {
+        if(draw.size() != m_k || m_k == 0)
         {
-            result = UrnOR::nextDraw(result);
-        }while (repetitions(result) || unsorted(result));
-        return result;
+            throwException<std::domain_error>("There is no valid ordinalnumber for this draw.");
+        }
+        for(uint posCount {}; posCount < m_k; ++posCount)
+        {
+            if(draw[posCount] >= m_n || (posCount > 0 && draw[posCount] <= draw[posCount - 1]))
+            {
+                throwException<std::domain_error>("There is no valid ordinalnumber for this draw.");
+            }
+        }
+        return z() - 1 - combinationComplement(m_n, m_k, [draw](uint posCount) { return draw[posCount]; });
     }
 
-    Draw Urn::backDraw(Draw draw) const
+    //MinimalChange – enumeration where a step changes at most two positions.
+
+    MinimalChange::MinimalChange(const UrnOR& urn): m_n { urn.n() },
+                                                    m_k { urn.k() },
+                                                    m_order { urn.order() },
+                                                    m_repetition { urn.repetition() },
+                                                    m_valid { urn.k() > 0 },
+                                                    m_draw {},
+                                                    m_changes {},
+                                                    m_changeCount {}
     {
-        if(repetitions(draw) || unsorted(draw) || draw == Urn::draw(0))
+        if(!m_valid)
+        {
+            return;
+        }
+        if(m_order && m_repetition)
         {
-            throw std::domain_error("Either the specified draw is incorrect or there is no next valid draw");
+            m_draw.assign(m_k, 0);
+            m_digits.assign(m_k, 0);
+            m_directions.assign(m_k, 1);
+            for(uint fillCount {}; fillCount <= m_k; ++fillCount)
+            {
+                m_focus.push_back(fillCount);
+            }
+            return;
         }
+        //UrnR enumerates the combinations of n+k-1 balls, the draw is d[i] = c[i] - i.
+        const uint combinationBalls {m_repetition ? m_n + m_k - 1 : m_n};
+        m_combinationSize = m_k;
+        m_combination.assign(m_k + 2, 0);
+        for(uint fillCount {1}; fillCount <= m_k; ++fillCount)
+        {
+            m_combination[fillCount] = fillCount - 1;
+            m_draw.push_back(m_repetition ? 0 : fillCount - 1);
+        }
+        m_combination[m_k + 1] = combinationBalls;
+        if(m_order)
+        {
+            resetPlainChange();
+        }
+    }
 
-        Draw result {draw};
-        do
+    bool MinimalChange::valid() const
+    {
+        return m_valid;
+    }
+
+    const Draw& MinimalChange::draw() const
+    {
+        return m_draw;
+    }
+
+    std::span<const Change> MinimalChange::changes() const
+    {
+        return std::span<const Change>(m_changes.data(), m_changeCount);
+    }
+
+    void MinimalChange::record(uint position, uint newBall)
+    {
+        m_changes[m_changeCount++] = Change{position, m_draw[position], newBall};
+        m_draw[position] = newBall;
+    }
+
+    bool MinimalChange::next()
+    {
+        m_changeCount = 0;
+        if(!m_valid)
         {
-            result = UrnOR::backDraw(result);
-        }while (repetitions(result) || unsorted(result));
-        return result;
+            return false;
+        }
+        if(m_order && m_repetition)
+        {
+            m_valid = nextGrayCode();
+            return m_valid;
+        }
+        if(m_order && nextPlainChange())
+        {
+            return true;
+        }
+
+        std::array<Change, 2> combinationChanges {};
+        const uint count {nextCombination(combinationChanges)};
+        if(count == 0)
+        {
+            m_valid = false;
+            return false;
+        }
+        if(!m_order)
+        {
+            for(uint changeCount {}; changeCount < count; ++changeCount)
+            {
+                const uint position {combinationChanges[changeCount].position};
+                record(position, combinationChanges[changeCount].newBall - (m_repetition ? position : 0));
+            }
+            return true;
+        }
+
+        //UrnO: one ball of the set is replaced at its position, then its arrangements are enumerated again.
+        uint removedBall {combinationChanges[0].oldBall};
+        uint addedBall {combinationChanges[0].newBall};
+        if(count == 2)
+        {
+            const Change& first {combinationChanges[0]};
+            const Change& second {combinationChanges[1]};
+            removedBall = first.oldBall == second.newBall ? second.oldBall : first.oldBall;
+            addedBall = first.newBall == second.oldBall ? second.newBall : first.newBall;
+        }
+        const auto position {std::find(m_draw.begin(), m_draw.end(), removedBall) - m_draw.begin()};
+        record(static_cast<uint>(position), addedBall);
+        resetPlainChange();
+        return true;
+    }
+
+    bool MinimalChange::nextGrayCode()
+    {
+        //Digit j of Knuth's a_(k-1)...a_0 is position k-1-j of the draw, so the last position changes most often.
+        if(m_n < 2)
+        {
+            return false;
+        }
+        const uint digit {m_focus[0]};
+        m_focus[0] = 0;
+        if(digit == m_k)
+        {
+            return false;
+        }
+        m_digits[digit] = static_cast<uint>(static_cast<int>(m_digits[digit]) + m_directions[digit]);
+        record(m_k - 1 - digit, m_digits[digit]);
+        if(m_digits[digit] == 0 || m_digits[digit] == m_n - 1)
+        {
+            m_directions[digit] = -m_directions[digit];
+            m_focus[digit] = m_focus[digit + 1];
+            m_focus[digit + 1] = digit + 1;
+        }
+        return true;
+    }
+
+    uint MinimalChange::nextCombination(std::array<Change, 2>& combinationChanges)
+    {
+        //Knuth's steps R3 to R5 with c_1 < ... < c_t; position j of the combination is position j-1 of the sorted draw.
+        std::vector<uint>& c {m_combination};
+        const uint t {m_combinationSize};
+        auto change = [&](uint changeCount, uint j, uint newBall)
+        {
+            combinationChanges[changeCount] = Change{j - 1, c[j], newBall};
+            c[j] = newBall;
+        };
+
+        uint j {2};
+        bool increase {};
+        if(t % 2 == 1)
+        {
+            if(c[1] + 1 < c[2])
+            {
+                change(0, 1, c[1] + 1);
+                return 1;
+            }
+        }
+        else
+        {
+            if(c[1] > 0)
+            {
+                change(0, 1, c[1] - 1);
+                return 1;
+            }
+            increase = true;
+        }
+        while(j <= t)
+        {
+            if(!increase)
+            {
+                //R4: try to decrease c_j.
+                if(c[j] >= j)
+                {
+                    const uint previous {c[j - 1]};
+                    change(0, j - 1, j - 2);
+                    change(1, j, previous);
+                    return 2;
+                }
+                ++j;
+                if(j > t)
+                {
+                    break;
+                }
+            }
+            //R5: try to increase c_j.
+            if(c[j] + 1 < c[j + 1])
+            {
+                const uint current {c[j]};
+                change(0, j - 1, current);
+                change(1, j, current + 1);
+                return 2;
+            }
+            ++j;
+            increase = false;
+        }
+        return 0;
+    }
+
+    void MinimalChange::resetPlainChange()
+    {
+        m_plainOffsets.assign(m_k + 1, 0);
+        m_plainDirections.assign(m_k + 1, 1);
+    }
+
+    bool MinimalChange::nextPlainChange()
+    {
+        //Knuth's steps P3 to P7, the positions a_(j-c_j+s) and a_(j-q+s) are 1-based.
+        int j {static_cast<int>(m_k)};
+        int shift {};
+        while(j > 0)
+        {
+            const int q {m_plainOffsets[j] + m_plainDirections[j]};
+            if(q == j)
+            {
+                if(j == 1)
+                {
+                    return false;
+                }
+                ++shift;
+            }
+            if(q < 0 || q == j)
+            {
+                m_plainDirections[j] = -m_plainDirections[j];
+                --j;
+                continue;
+            }
+            const uint first {static_cast<uint>(j - m_plainOffsets[j] + shift - 1)};
+            const uint second {static_cast<uint>(j - q + shift - 1)};
+            const uint firstBall {m_draw[first]};
+            record(first, m_draw[second]);
+            record(second, firstBall);
+            m_plainOffsets[j] = q;
+            return true;
+        }
+        return false;
     }
 }
\ No newline at end of file
@@ -29,6 +29,16 @@
 #include <cmath>
 #include <algorithm>
 #include <iterator>
+#include <cstdint>
+#include <span>
+#include <array>
+#include <memory>
+#include <initializer_list>
+#include <type_traits>
+#include <ranges>
+#include <random>
+#include <limits>
+#include <concepts>
 
 /*! 
  * \namespace urn
@@ -40,13 +50,596 @@ namespace urn
     using uint = unsigned int;       /*!< Using decleration to represent the set of natural numbers. */
     using Draw = std::vector<uint>;  /*!< Using decleration to represent a combination and permutation. */
 
-    //Helper function
+    /*
+     * The ordinal type is used for the number of draws and for ordinal numbers.
+     * By default it is a 64-bit unsigned integer. 
+     * Compiling with -DURN_ORDINAL_128 selects unsigned __int128 (GCC/Clang only).
+     */
+    #if defined(URN_ORDINAL_128)
+    using Ordinal       = unsigned __int128;    /*!< Using decleration for the number of draws and the ordinal numbers. */
+    using SignedOrdinal = __int128;             /*!< Using decleration for the signed counterpart of Ordinal, used for iterator distances. */
+    #else
+    using Ordinal       = std::uint64_t;        /*!< Using decleration for the number of draws and the ordinal numbers. */
+    using SignedOrdinal = std::int64_t;         /*!< Using decleration for the signed counterpart of Ordinal, used for iterator distances. */
+    #endif
+
+    constexpr Ordinal maxOrdinal {static_cast<Ordinal>(-1)};                    /*!< Largest value of type Ordinal. */
+    constexpr SignedOrdinal maxSignedOrdinal {static_cast<SignedOrdinal>(maxOrdinal >> 1)};   /*!< Largest value of type SignedOrdinal. */
+
+    #ifndef URN_SMALL_DRAW_CAPACITY
+    #define URN_SMALL_DRAW_CAPACITY 16  /*!< Number of balls a SmallDraw keeps without allocation, can be set with -DURN_SMALL_DRAW_CAPACITY=n. */
+    #endif
+
+    /*!
+     * \class BasicSmallDraw
+     * \brief Sequence of a runtime size which keeps up to N values inline and only allocates for larger sizes.
+     * Used to return draws without a heap allocation for k <= N.
+     * 
+     * @tparam T    Type of the values, must be trivially copyable and default constructible.
+     * @tparam N    Number of values which are kept inline.
+     */
+    template<class T, std::size_t N>
+    class BasicSmallDraw
+    {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>, "BasicSmallDraw requires a trivially copyable type.");
+
+        public:
+            using value_type        = T;                /*!< Using decleration for the value type. */
+            using size_type         = std::size_t;      /*!< Using decleration for the size type. */
+            using iterator          = T*;               /*!< Using decleration for the iterator. */
+            using const_iterator    = const T*;         /*!< Using decleration for the const iterator. */
+
+            /*!
+             * \brief Standard constructor for BasicSmallDraw, constructs an empty sequence.
+             */
+            BasicSmallDraw();
+
+            /*!
+             * \brief Constructor for BasicSmallDraw.
+             * @param[in] size   Number of values.
+             * @param[in] value  Value of all elements.
+             */
+            explicit BasicSmallDraw(size_type size, const T& value = T{});
+
+            /*!
+             * \brief Constructor for BasicSmallDraw from a list of values.
+             */
+            BasicSmallDraw(std::initializer_list<T> values);
+
+            /*!
+             * \brief Copy constructor for BasicSmallDraw.
+             */
+            BasicSmallDraw(const BasicSmallDraw& other);
+
+            /*!
+             * \brief Move constructor for BasicSmallDraw, takes over the allocation of other.
+             */
+            BasicSmallDraw(BasicSmallDraw&& other) noexcept;
+
+            /*!
+             * \brief Copy assignment for BasicSmallDraw.
+             */
+            BasicSmallDraw& operator=(const BasicSmallDraw& other);
+
+            /*!
+             * \brief Move assignment for BasicSmallDraw, takes over the allocation of other.
+             */
+            BasicSmallDraw& operator=(BasicSmallDraw&& other) noexcept;
+
+            /*!
+             * \brief Changes the number of values, new values are value-initialized.
+             */
+            void resize(size_type size);
+
+            /*!
+             * \brief Getter method which returns the number of values.
+             */
+            size_type size() const;
+
+            /*!
+             * \brief Indicates whether the sequence is empty.
+             */
+            bool empty() const;
+
+            /*!
+             * \brief Indicates whether the values are kept inline.
+             * \return true if the size has never exceeded N.
+             */
+            bool isInline() const;
+
+            /*!
+             * \brief Pointer to the first value.
+             */
+            T* data();
+
+            /*!
+             * \brief Pointer to the first value.
+             */
+            const T* data() const;
+
+            T* begin();                 /*!< Iterator to the first value. */
+            T* end();                   /*!< Iterator after the last value. */
+            const T* begin() const;     /*!< Iterator to the first value. */
+            const T* end() const;       /*!< Iterator after the last value. */
+
+            /*!
+             * \brief Operator for index, the index is not checked.
+             */
+            T& operator[](size_type index);
+
+            /*!
+             * \brief Operator for index, the index is not checked.
+             */
+            const T& operator[](size_type index) const;
+
+            /*!
+             * \brief Conversion to a vector, used by the vector returning interfaces.
+             */
+            std::vector<T> toVector() const;
+
+            /*!
+             * \brief Operator for equal to comparison of the values.
+             */
+            bool operator==(const BasicSmallDraw& other) const;
+
+        private:
+            std::array<T, N> m_inline {};       //!< Values if size <= N.
+            std::unique_ptr<T[]> m_heap {};     //!< Values if the size has exceeded N, kept when the size shrinks.
+            size_type m_size {};                //!< Number of values.
+            size_type m_capacity {N};           //!< Number of values which fit without an allocation.
+    };
+
+    using SmallDraw = BasicSmallDraw<uint, URN_SMALL_DRAW_CAPACITY>;    /*!< Using decleration for a draw which does not allocate for k <= URN_SMALL_DRAW_CAPACITY. */
+
+    /*!
+     * \enum enum class Layout
+     * \brief Arrangement of several draws in a contiguous buffer, used by fill().
+     * rowMajor: the k balls of a draw follow each other, draw i starts at index i*k.
+     * columnMajor: the balls of one position follow each other, position p of draw i is at index p*count+i.
+     */
+    enum class Layout
+    {
+        rowMajor,
+        columnMajor
+    };
+
+    /*!
+     * \class CounterRng
+     * \brief Counter based random number generator, which fulfills the requirements of a uniform random bit generator.
+     * The i-th number of a stream is the SplitMix64 mix of a key, which is derived from seed and stream, and the counter i.
+     * So every stream can be created and advanced in O(1), e.g. one stream per thread or per shard,
+     * and a parallel sampler produces the same draws for the same seed independent of the scheduling.
+     */
+    class CounterRng
+    {
+        public:
+            using result_type = std::uint64_t;  /*!< Using decleration for the result type. */
+
+            /*!
+             * \brief Constructor for CounterRng.
+             * @param[in] seed    The seed.
+             * @param[in] stream  The index of the stream, different streams of a seed are independent.
+             */
+            explicit CounterRng(std::uint64_t seed = 0, std::uint64_t stream = 0);
+
+            /*!
+             * \brief Smallest random number.
+             */
+            static constexpr result_type min() { return 0; }
+
+            /*!
+             * \brief Largest random number.
+             */
+            static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+            /*!
+             * \brief Returns the next random number and increments the counter.
+             */
+            result_type operator()();
+
+            /*!
+             * \brief Skips count random numbers in O(1).
+             */
+            void discard(std::uint64_t count);
+
+            /*!
+             * \brief Getter method which returns the counter.
+             * \return The number of random numbers returned or skipped since construction.
+             */
+            std::uint64_t counter() const;
+
+        private:
+            std::uint64_t m_key;            //!< Key of the stream.
+            std::uint64_t m_counter {};     //!< Index of the next random number.
+    };
+
+    /*!
+     * \struct Cursor
+     * \brief Position of an enumeration, which can be saved and restored to resume the enumeration later.
+     * A cursor records the urn model, n, k, the ordinal number and the draw at this ordinal number.
+     * It is created with UrnOR::Iterator::cursor() and restored with UrnOR::begin(const Cursor&).
+     * The text token has the form "UrnO 10 3 42 0 5 4", i.e. model, n, k, ordinal number and the k balls.
+     * The binary token consists of the magic bytes "URNC", a version byte, a byte with the flags order (1) and repetition (2),
+     * n and k as 4 bytes, the ordinal number as 16 bytes and the k balls as 4 bytes each, all in little endian order.
+     * Both tokens are the same for Ordinal of 64 and 128 bits.
+     */
+    struct Cursor
+    {
+        bool order {};          //!< Indicates whether the order of the balls is important for the urn model.
+        bool repetition {};     //!< Indicates whether the urn model contains repetitions.
+        uint n {};              //!< The number of balls inside the urn.
+        uint k {};              //!< The size of a draw from the urn.
+        Ordinal ordinal {};     //!< The ordinal number of the draw, z for the end of the enumeration.
+        Draw draw;              //!< The draw with the ordinal number, k zeros at the end of the enumeration.
+
+        /*!
+         * \brief Converts the cursor to its text token.
+         * \return The text token.
+         */
+        std::string toText() const;
+
+        /*!
+         * \brief Converts a text token to a cursor.
+         * If the token is malformed, an std::invalid_argument is thrown.
+         * \return The cursor of the token.
+         */
+        static Cursor fromText(const std::string& text);
+
+        /*!
+         * \brief Converts the cursor to its binary token of 30 + 4k bytes.
+         * \return The binary token.
+         */
+        std::vector<std::uint8_t> toBinary() const;
+
+        /*!
+         * \brief Converts a binary token to a cursor.
+         * If the token is malformed, an std::invalid_argument is thrown.
+         * If the ordinal number is not representable by Ordinal, an std::overflow_error is thrown.
+         * \return The cursor of the token.
+         */
+        static Cursor fromBinary(std::span<const std::uint8_t> binary);
+
+        /*!
+         * \brief Operator for equal to comparison of all members.
+         */
+        bool operator==(const Cursor& other) const = default;
+    };
+
+    //Statistics
+
+    /*!
+     * \struct Stats
+     * \brief Counters of the hot paths of the urn models.
+     * The counters are only collected if the library and the program are compiled with -DURN_STATS, otherwise they stay 0
+     * and the counting is compiled out. Every thread counts into its own counters, so counting needs no synchronization.
+     * ThreadPool::run() adds the counters of its workers to the counters of the calling thread when the run ends.
+     */
+    struct Stats
+    {
+        std::uint64_t unranks {};           //!< Draws calculated from their ordinal number by unrank().
+        std::uint64_t successorSteps {};    //!< Steps of successor() and predecessor().
+        std::uint64_t rejections {};        //!< Draws rejected by repetitions() or unsorted().
+        std::uint64_t drawAllocations {};   //!< Draws of type Draw constructed by draw(), sample() and the iterators, which return copies of their draw.
+        std::uint64_t exceptions {};        //!< Exceptions thrown by the urn models.
+
+        /*!
+         * \brief Adds the counters of other, e.g. to combine the statistics of several threads.
+         */
+        Stats& operator+=(const Stats& other);
+
+        /*!
+         * \brief Operator for equal to comparison of all counters.
+         */
+        bool operator==(const Stats& other) const = default;
+    };
+
+    #if defined(URN_STATS)
+    inline thread_local Stats threadStats {};   /*!< Counters of the calling thread. */
+    #define URN_COUNT(counter) (++::urn::threadStats.counter)   /*!< Increments a counter of the calling thread. */
+    #else
+    #define URN_COUNT(counter) ((void)0)                        /*!< Counting is compiled out. */
+    #endif
+
+    constexpr bool statsEnabled {
+    #if defined(URN_STATS)
+        true
+    #else
+        false
+    #endif
+    };  /*!< Indicates whether the counters of Stats are collected. */
+
+    /*!
+     * \brief Throws an exception of type EXCEPTION and counts it in Stats::exceptions.
+     * All exceptions of the urn models are thrown with this function. During constant evaluation nothing is counted.
+     * @param[in] message  The message of the exception.
+     */
+    template<class EXCEPTION, class MESSAGE>
+    [[noreturn]] constexpr void throwException(const MESSAGE& message)
+    {
+        if(!std::is_constant_evaluated())
+        {
+            URN_COUNT(exceptions);
+        }
+        throw EXCEPTION(message);
+    }
+
+    /*!
+     * \brief Returns the counters of the calling thread, which are all 0 without -DURN_STATS.
+     * \return Copy of the counters of type Stats.
+     */
+    Stats statsSnapshot();
+
+    /*!
+     * \brief Sets the counters of the calling thread to 0.
+     */
+    void resetStats();
+
+    /*!
+     * \brief Adds stats to the counters of the calling thread, e.g. the counters of worker threads. Does nothing without -DURN_STATS.
+     */
+    void addStats(const Stats& stats);
+
+    //Helper functions
+
+    /*!
+     * \brief Helper function for an overflow-checked addition.
+     * If the sum is not representable by Ordinal, an std::overflow_error is thrown.
+     * \return Sum of a and b of type Ordinal.
+     */
+    constexpr Ordinal checkedAdd(const Ordinal& a, const Ordinal& b);
+
+    /*!
+     * \brief Helper function for an overflow-checked multiplication.
+     * If the product is not representable by Ordinal, an std::overflow_error is thrown.
+     * \return Product of a and b of type Ordinal.
+     */
+    constexpr Ordinal checkedMultiply(const Ordinal& a, const Ordinal& b);
+
+    /*!
+     * \brief Helper function for calculating the greatest common divisor.
+     * std::gcd is not used, because it does not accept unsigned __int128 in strict ISO mode.
+     * \return Greatest common divisor of a and b of type Ordinal.
+     */
+    constexpr Ordinal greatestCommonDivisor(Ordinal a, Ordinal b);
+
+    /*!
+     * \brief Helper function for calculating a*b/c exactly, if c divides a*b.
+     * For a 64 bit Ordinal the product is calculated with 128 bits.
+     * For a 128 bit Ordinal the factors are reduced by their common divisors first, so that no intermediate value exceeds the result.
+     * If the result is not representable by Ordinal, an std::overflow_error is thrown.
+     * \return a*b/c of type Ordinal.
+     */
+    constexpr Ordinal multiplyDivide(Ordinal a, Ordinal b, Ordinal c);
+
+    /*!
+     * \brief Helper function for calculating n to the power of k exactly.
+     * If the result is not representable by Ordinal, an std::overflow_error is thrown.
+     * \return n to the power of k of type Ordinal.
+     */
+    constexpr Ordinal power(const uint& n, const uint& k);
     
     /*!
      * \brief Helper function for calculating the faculty.
-     * \return Faculty of n of type uint.
+     * If the result is not representable by Ordinal, an std::overflow_error is thrown.
+     * \return Faculty of n of type Ordinal.
+     */
+    constexpr Ordinal factorial(const uint& n);
+
+    /*!
+     * \brief Helper function for calculating the falling factorial n!/(n-k)! without computing n!.
+     * If the result is not representable by Ordinal, an std::overflow_error is thrown.
+     * \return Falling factorial of n and k of type Ordinal, 0 if k > n.
+     */
+    constexpr Ordinal fallingFactorial(const uint& n, const uint& k);
+
+    /*!
+     * \brief Helper function for calculating the binomial coefficient n over k.
+     * The calculation is exact. An intermediate result never exceeds the final result,
+     * so an std::overflow_error is only thrown if the binomial coefficient itself is not representable by Ordinal.
+     * \return Binomial coefficient of n and k of type Ordinal, 0 if k > n.
+     */
+    constexpr Ordinal binomial(const uint& n, const uint& k);
+
+    /*!
+     * \brief Helper function which converts an ordinal number to its decimal representation.
+     * Works for Ordinal of 64 and 128 bits, for which std::to_string is not available.
+     * \return Decimal representation of ordinalnumber.
+     */
+    std::string ordinalToString(Ordinal ordinalnumber);
+
+    /*!
+     * \brief Helper function which converts a decimal representation to an ordinal number.
+     * If text is not a decimal number, an std::invalid_argument is thrown.
+     * If the number is not representable by Ordinal, an std::overflow_error is thrown.
+     * \return The ordinal number of text.
+     */
+    Ordinal stringToOrdinal(const std::string& text);
+
+    /*!
+     * \brief Helper function which returns a uniformly distributed ordinal number from 0 to z-1.
+     * Takes 64 bit words from rng and rejects the values of an incomplete last range, so there is no modulo bias.
+     * A generator with the full 64 bit range, like CounterRng, is used directly, so the result is the same on every platform.
+     * If z is 0, an std::domain_error is thrown.
+     * @param[in] rng  Uniform random bit generator.
+     * @param[in] z    The number of ordinal numbers.
+     * \return The random ordinal number.
      */
-    uint factorial(const uint& n);
+    template<class RNG>
+    Ordinal uniformOrdinal(RNG& rng, const Ordinal& z);
+
+    /*!
+     * \brief Helper function for calculating the first ordinal number of a shard.
+     * The ordinal numbers 0 to z-1 are split into m contiguous shards whose sizes differ by at most one.
+     * The calculation does not overflow for any z.
+     * \return The first ordinal number of shard i of m, z for i = m.
+     */
+    Ordinal shardBegin(const Ordinal& z, const Ordinal& i, const Ordinal& m);
+
+    /*!
+     * \brief Helper function which writes the combination with the given ordinal number into draw.
+     * The combinations of k out of the balls 0 to n-1 are numbered in lexicographic order (combinatorial number system).
+     * Runs in O(n+k) steps without any allocation. The ordinal number must be smaller than binomial(n, k).
+     * @param[in] n              The number of balls inside the urn.
+     * @param[in] ordinalnumber  The ordinal number of the combination.
+     * @param[out] draw          Span of size k which receives the strictly increasing combination.
+     */
+    void unrankCombination(const uint& n, Ordinal ordinalnumber, std::span<uint> draw);
+
+    /*!
+     * \class ReverseIterator 
+     * \brief Reverse adaptor for the iterators of the urns.
+     * std::reverse_iterator dereferences a temporary copy of the underlying iterator (*--tmp),
+     * which would copy the iterator and calculate its predecessor on every dereference.
+     * ReverseIterator therefore keeps an iterator to the element itself (one before base()).
+     * 
+     * @tparam ITERATOR     Type of the underlying iterator.
+     */
+    template<class ITERATOR>
+    class ReverseIterator
+    {
+        public:
+            using iterator_type     = ITERATOR;                                 /*!< Using decleration for the type of the underlying iterator.*/
+            using iterator_category = typename ITERATOR::iterator_category;     /*!< Using decleration for the iterator category of the underlying iterator.*/
+            using iterator_concept  = typename ITERATOR::iterator_concept;      /*!< Using decleration for the C++20 iterator concept of the underlying iterator.*/
+            using difference_type   = typename ITERATOR::difference_type;       /*!< Using decleration for the difference type of the underlying iterator.*/
+            using value_type        = typename ITERATOR::value_type;            /*!< Using decleration for the value type of the underlying iterator.*/
+            using pointer           = typename ITERATOR::pointer;               /*!< Using decleration for the pointer of the underlying iterator.*/
+            using reference         = typename ITERATOR::reference;             /*!< Using decleration for the reference of the underlying iterator.*/
+            using size_type         = typename ITERATOR::size_type;             /*!< Using decleration for the size type of the underlying iterator.*/
+
+            /*!
+             * \brief Standard constructor for ReverseIterator.
+             */
+            ReverseIterator();
+
+            /*!
+             * \brief Constructor for ReverseIterator.
+             * Like std::reverse_iterator, the reverse iterator refers to the element before base.
+             * @param[in] base     Iterator to the element after the element the reverse iterator refers to.
+             */
+            explicit ReverseIterator(const ITERATOR& base);
+
+            /*!
+             * \brief Returns the underlying iterator.
+             * \return Iterator to the element after the element the reverse iterator refers to.
+             */
+            ITERATOR base() const;
+
+            /*!
+             * \brief Operator for pointer dereferencing. 
+             * \return Returns the current draw of the underlying iterator.
+             */
+            reference operator*() const;
+
+            /*!
+             * \brief Operator for pre-incrementation, which decrements the underlying iterator. 
+             * \return Returns the incremented iterator. 
+             */
+            ReverseIterator& operator++();
+
+            /*!
+             * \brief Operator for post-incrementation. 
+             * \return Returns the iterator before incrementation. 
+             */
+            ReverseIterator operator++(int);
+
+            /*!
+             * \brief Operator for pre-decrementation, which increments the underlying iterator. 
+             * \return Returns the decremented iterator. 
+             */
+            ReverseIterator& operator--();
+
+            /*!
+             * \brief Operator for post-decrementation. 
+             * \return Returns the iterator before decrementation. 
+             */
+            ReverseIterator operator--(int);
+
+            /*!
+             * \brief Operator for equal to comparison. 
+             * \return Returns the evaluated expression. 
+             */
+            bool operator== (const ReverseIterator& other) const;
+
+            /*!
+             * \brief Operator for not equal to comparison. 
+             * \return Returns the evaluated expression. 
+             */
+            bool operator!= (const ReverseIterator& other) const;
+
+            /*!
+             * \brief Operator for less than comparison. 
+             * \return Returns the evaluated expression. 
+             */
+            bool operator< (const ReverseIterator& other) const;
+
+            /*!
+             * \brief Operator for greater than comparison. 
+             * \return Returns the evaluated expression. 
+             */
+            bool operator> (const ReverseIterator& other) const;
+
+            /*!
+             * \brief Operator for less than or equal to comparison. 
+             * \return Returns the evaluated expression. 
+             */
+            bool operator<=(const ReverseIterator& other) const;
+
+            /*!
+             * \brief Operator for greater than or equal to comparison. 
+             * \return Returns the evaluated expression. 
+             */
+            bool operator>=(const ReverseIterator& other) const;
+
+            /*!
+             * \brief Operator for addition assignment. 
+             * \return Returns the incremented iterator. 
+             */
+            ReverseIterator& operator+=(const difference_type& n);
+
+            /*!
+             * \brief Operator for addition. 
+             * \return Returns the sum of iterator and difference type n. 
+             */
+            ReverseIterator operator+(const difference_type& n) const;
+
+            /*!
+             * \brief Operator for addition (outside class definition).
+             * Implemented in the hpp to keep it simple 
+             * \return Returns the sum of iterator and difference type n. 
+             */
+            friend ReverseIterator operator+(const difference_type& n, const ReverseIterator& other)
+            {
+                return other + n;
+            }
+
+            /*!
+             * \brief Operator for substraction assignment. 
+             * \return Returns the decremented iterator. 
+             */
+            ReverseIterator& operator-=(const difference_type& n);
+
+            /*!
+             * \brief Operator for substraction. 
+             * \return Returns the difference of iterator and difference type n. 
+             */
+            ReverseIterator operator-(const difference_type& n) const;
+
+            /*!
+             * \brief Operator for distance. 
+             * \return Returns the distance between the two iterators.
+             */
+            difference_type operator-(const ReverseIterator& other) const;
+
+            /*!
+             * \brief Operator for index. 
+             * \return Returns a copy of the draw n positions after the current draw in reverse order.
+             */
+            value_type operator[](const difference_type& n) const;
+
+        protected:
+            ITERATOR m_current;     //!< Iterator to the element the reverse iterator refers to.
+    };
 
     /*!
      * \class UrnOR – urn where the order is important and which contains repetitions.
@@ -60,16 +653,20 @@ namespace urn
              * \brief Iterator which fulfills the requirements as a random access iterator.
              * The behavior is based on the std::vector class. 
              * The special feature of the iterator is that it does not use a memory structure like a vector.
+             * The iterator keeps the current draw. Incrementing and decrementing replace it in place 
+             * by its successor or predecessor, so a walk over the urn does not calculate every draw from its ordinal number.
+             * Jumps calculate the draw from the new ordinal number. A const iterator is never changed, so several threads can dereference it.
              */
             class Iterator
             {   
                 public:
-                    using iterator_category = std::random_access_iterator_tag;  /*!< Using decleration for the iterator category which is std::random_access_iterator.*/
-                    using difference_type   = std::ptrdiff_t;                   /*!< Using decleration for the difference type which is ptrdiff_t.*/
+                    using iterator_category = std::random_access_iterator_tag;  /*!< Using decleration for the iterator category which is std::random_access_iterator, so that the classic and the parallel algorithms jump in O(1).*/
+                    using iterator_concept  = std::random_access_iterator_tag;  /*!< Using decleration for the C++20 iterator concept, so that std::ranges and the parallel algorithms treat the iterator as random access iterator.*/
+                    using difference_type   = SignedOrdinal;                    /*!< Using decleration for the difference type which is SignedOrdinal.*/
                     using value_type        = Draw;                             /*!< Using decleration for the value type which is Draw (vector<uint>).*/
                     using pointer           = Draw*;                            /*!< Using decleration for the pointer which is Draw* (vector<uint>*).*/
-                    using reference         = const Draw;                       /*!< Using decleration for the reference. The type is const Draw due to an error in the standard library when using the std::make_reverse_iterator (http://gcc.gnu.org/PR51823).*/
-                    using size_type         = std::size_t;                      /*!< Using decleration for the size type which is size_t.*/
+                    using reference         = Draw;                             /*!< Using decleration for the reference, the draw is returned by value, because the iterator keeps it itself.*/
+                    using size_type         = Ordinal;                          /*!< Using decleration for the size type which is Ordinal.*/
 
                     /*!
                      * \enum enum class Status
@@ -84,7 +681,16 @@ namespace urn
                      * @param[in] ordinalnumber     Indicates the ordinal number of a draw.
                      * @param[in] check             Indicates the status of the iterator.
                      */
-                    Iterator(const UrnOR* urn, const uint& ordinalnumber, const Status& status);
+                    Iterator(const UrnOR* urn, const Ordinal& ordinalnumber, const Status& status);
+
+                    /*!
+                     * \brief Constructor for Iterator at a known draw.
+                     * The draw is kept as current draw, so it is not calculated again from the ordinal number.
+                     * @param[in] urn               Pointer to an urn on which the various functions are executed.
+                     * @param[in] ordinalnumber     The ordinal number of draw, which must be smaller than z.
+                     * @param[in] draw              The draw with the ordinal number.
+                     */
+                    Iterator(const UrnOR* urn, const Ordinal& ordinalnumber, const Draw& draw);
 
                     /*!
                      * \brief Standard constructor for Iterator.
@@ -114,20 +720,27 @@ namespace urn
                      * \brief Getter method which returns z.
                      * \return z the number of all possible draws.
                      */
-                    uint z() const;
+                    Ordinal z() const;
     
                     /*!
                      * \brief Getter method which returns ordinalnumber.
                      * \return ordinalnumber the ordinal number of the current draw.
                      */
-                    int ordinalnumber() const;
+                    SignedOrdinal ordinalnumber() const;
+
+                    /*!
+                     * \brief Saves the position of the iterator.
+                     * If the iterator is before the begin or after the end, an std::domain_error is thrown.
+                     * \return Cursor with the urn model, n, k, the ordinal number and the current draw.
+                     */
+                    Cursor cursor() const;
             
                     /*!
                      * \brief Operator for pointer dereferencing. 
-                     * \return Returns the current draw of the iterator as value type.
+                     * \return Returns a copy of the current draw of the iterator.
                      * If the iterator is outside the range, a vector filled with zeros is returned. 
                      */
-                    const value_type operator*() const; 
+                    reference operator*() const; 
                     
                     /*!
                      * \brief Operator for pre-incrementation. 
@@ -226,11 +839,36 @@ namespace urn
                      */
                     difference_type operator-(const Iterator& other) const;
 
+                    /*!
+                     * \brief Operator for equal to comparison with the end of the urn.
+                     * \return Returns true if the iterator is at or after the end of the urn.
+                     */
+                    bool operator== (std::default_sentinel_t) const;
+
+                    /*!
+                     * \brief Operator for distance to the end of the urn.
+                     * \return Returns the number of draws from the iterator to the end of the urn.
+                     */
+                    friend difference_type operator-(std::default_sentinel_t, const Iterator& other)
+                    {
+                        return static_cast<difference_type>(other.m_z) - other.m_ordinalnumber;
+                    }
+
+                    /*!
+                     * \brief Operator for distance from the end of the urn.
+                     * \return Returns the negative number of draws from the iterator to the end of the urn.
+                     */
+                    friend difference_type operator-(const Iterator& other, std::default_sentinel_t)
+                    {
+                        return other.m_ordinalnumber - static_cast<difference_type>(other.m_z);
+                    }
+
                     /*!
                      * \brief Operator for index. 
-                     * \return Returns the draw to the given index.
+                     * \return Returns a copy of the draw n positions after the current draw, like *(*this + n).
+                     * If the index is outside the range, a vector filled with zeros is returned. 
                      */
-                    reference operator[](size_type index) const; 
+                    value_type operator[](const difference_type& n) const; 
 
                     /*!
                      * \brief Destructor for Iterator.
@@ -239,9 +877,28 @@ namespace urn
                     ~Iterator();
 
                 protected:
-                    const UrnOR* m_urn;     //!< Pointer to an urn on which the various functions are executed.
-                    int m_ordinalnumber;    //!< Indicates the ordinal number of a draw.
-                    Status m_status;        //!< Indicates the status of the iterator
+                    /*!
+                     * \brief Checks whether the ordinal number of the iterator belongs to a draw.
+                     * \return true/false depends if the ordinal number is in the range from 0 to z-1.
+                     */
+                    bool inRange() const;
+
+                    /*!
+                     * \brief Sets the status according to the ordinal number.
+                     */
+                    void updateStatus();
+
+                    /*!
+                     * \brief Calculates the current draw from the ordinal number.
+                     * Outside the range the draw is filled with zeros.
+                     */
+                    void load();
+
+                    const UrnOR* m_urn;             //!< Pointer to an urn on which the various functions are executed.
+                    SignedOrdinal m_ordinalnumber;  //!< Indicates the ordinal number of a draw.
+                    Status m_status;                //!< Indicates the status of the iterator
+                    Ordinal m_z {};                 //!< The number of all possible draws of the urn, kept to avoid calls of z().
+                    Draw m_draw;                    //!< The current draw of the iterator, which always belongs to the ordinal number.
         };
 
         public:
@@ -252,6 +909,7 @@ namespace urn
              * The check parameter is not intended to be specified by the user.
              * The constructor body performs a check that is specific for the UrnOR, if the check value is 1.
              * If the UrnOR exemplar to be created is invalid, an exception is thrown.
+             * The constructor also builds the table of the powers of n which is used by z() and draw().
              * @param[in] n      The number of balls inside the urn.
              * @param[in] k      The size of a draw from the urn.
              * @param[in] check  The check value.
@@ -272,33 +930,73 @@ namespace urn
 
             /*!
              * \brief Getter method which returns z.
+             * If z is not representable by Ordinal, an std::overflow_error is thrown.
              * \return z the number of all possible draws.
              */
-            virtual uint z() const; 
+            virtual Ordinal z() const; 
+
+            /*!
+             * \brief Indicates whether the order of the balls is important for the urn model.
+             * \return true
+             */
+            virtual bool order() const;
+
+            /*!
+             * \brief Indicates whether the urn model contains repetitions.
+             * \return true
+             */
+            virtual bool repetition() const;
 
             /*!
              * \brief Begin iterator.
              * \return Returns an iterator pointing to the first element in the sequence.
              */
-            Iterator begin();
+            Iterator begin() const;
+
+            /*!
+             * \brief Begin iterator at a given draw.
+             * The position is calculated with rank(), so the enumeration can start at any known draw without a linear search.
+             * \return Returns an iterator pointing to the given draw.
+             */
+            Iterator begin(const Draw& draw) const;
+
+            /*!
+             * \brief Begin iterator at a saved position.
+             * The draw of the cursor becomes the current draw of the iterator, so resuming costs one rank() to check it.
+             * If the cursor belongs to another urn model, n or k, or if the draw does not match the ordinal number,
+             * an std::domain_error is thrown.
+             * \return Returns an iterator pointing to the draw of the cursor, or end() for a cursor at the end.
+             */
+            Iterator begin(const Cursor& cursor) const;
 
             /*!
              * \brief End iterator.
              * \return Returns an iterator to the end (i.e. the element after the last element) of the given range.
              */
-            Iterator end();
+            Iterator end() const;
 
             /*!
              * \brief Reverse begin iterator.
              * \return Returns an iterator to the reverse-beginning of the given range.
              */
-            std::reverse_iterator<UrnOR::Iterator> rbegin();
+            ReverseIterator<UrnOR::Iterator> rbegin() const;
 
             /*!
              * \brief Reverse begin iterator.
              * \return Returns an iterator to the reverse-end of the given range.
              */
-            std::reverse_iterator<UrnOR::Iterator> rend();
+            ReverseIterator<UrnOR::Iterator> rend() const;
+
+            /*!
+             * \brief Shard of the draws, used to split an enumeration across threads, processes or machines.
+             * The ordinal numbers 0 to z-1 are split into m contiguous shards whose sizes differ by at most one.
+             * Both iterators of the shard calculate their draw from the ordinal number, the shard boundaries are calculated in O(1).
+             * If i >= m, an std::domain_error is thrown.
+             * @param[in] i  The index of the shard from 0 to m-1.
+             * @param[in] m  The number of shards.
+             * \return Returns the sized range of the draws of shard i.
+             */
+            std::ranges::subrange<Iterator> shard(const Ordinal& i, const Ordinal& m) const;
 
             /*!
              * \brief Checks whether the given draw is contained in the urn or not.
@@ -318,11 +1016,40 @@ namespace urn
              */
             virtual Draw backDraw(Draw draw) const;
 
+            /*!
+             * \brief Replaces the given draw in place by its subsequent draw.
+             * The draw is not checked, so the method is the building block for iterators and other hot paths.
+             * \return true if there is a subsequent draw, otherwise false and the content of draw is unspecified.
+             */
+            virtual bool successor(std::span<uint> draw) const;
+
+            /*!
+             * \brief Replaces the given draw in place by its previous draw.
+             * The draw is not checked, so the method is the building block for iterators and other hot paths.
+             * \return true if there is a previous draw, otherwise false and the content of draw is unspecified.
+             */
+            virtual bool predecessor(std::span<uint> draw) const;
+
             /*!
              * \brief Calculates the corresponding draw from a given ordinal number.
+             * Thin adapter which calls unrank().
              * \return Draw of type Draw.
              */
-            virtual Draw draw(uint ordinalnumber) const;
+            Draw draw(Ordinal ordinalnumber) const;
+
+            /*!
+             * \brief Calculates the corresponding draw from a given ordinal number without an allocation for k <= URN_SMALL_DRAW_CAPACITY.
+             * \return Draw of type SmallDraw.
+             */
+            SmallDraw smallDraw(Ordinal ordinalnumber) const;
+
+            /*!
+             * \brief Writes the draw with the given ordinal number into draw, which must have the size k.
+             * If the ordinal number is outside the range, an std::domain_error is thrown.
+             * @param[in] ordinalnumber  The ordinal number of the draw.
+             * @param[out] draw          Span of size k which receives the draw.
+             */
+            void unrank(Ordinal ordinalnumber, std::span<uint> draw) const;
       
             /*!
              * \brief Returns the first draw of the urn.
@@ -336,6 +1063,46 @@ namespace urn
              */
             virtual Draw lastDraw() const;
 
+            /*!
+             * \brief Calculates the ordinal number of a given draw, the inverse of draw().
+             * If the draw is not contained in the urn, an std::domain_error is thrown.
+             * \return Ordinal number of type Ordinal.
+             */
+            Ordinal rank(const Draw& draw) const;
+
+            /*!
+             * \brief Writes count consecutive draws, starting with the draw of the ordinal number first, into out.
+             * The first draw is calculated from its ordinal number, the following draws with successor() in place, 
+             * so no draw is allocated. out must provide count*k elements.
+             * If the draws do not exist, an std::domain_error is thrown, if out is too small, an std::length_error is thrown.
+             * @param[in] first     Ordinal number of the first draw.
+             * @param[in] count     Number of draws.
+             * @param[out] out      Buffer which receives the draws.
+             * @param[in] layout    Arrangement of the draws in out.
+             */
+            void fill(Ordinal first, Ordinal count, std::span<uint> out, Layout layout = Layout::rowMajor) const;
+
+            /*!
+             * \brief Returns a uniformly distributed random draw.
+             * A uniformly distributed ordinal number is calculated with uniformOrdinal() and converted with unrank().
+             * If the urn contains no draw, an std::domain_error is thrown.
+             * @param[in] rng  Uniform random bit generator, e.g. CounterRng or std::mt19937_64.
+             * \return Random draw of type Draw.
+             */
+            template<class RNG>
+            Draw sample(RNG& rng) const;
+
+            /*!
+             * \brief Writes count independent, uniformly distributed random draws one after another into out.
+             * No draw is allocated. out must provide count*k elements.
+             * If the urn contains no draw, an std::domain_error is thrown, if out is too small, an std::length_error is thrown.
+             * @param[in] rng    Uniform random bit generator, e.g. CounterRng or std::mt19937_64.
+             * @param[in] count  Number of draws.
+             * @param[out] out   Buffer which receives the draws.
+             */
+            template<class RNG>
+            void sample_n(RNG& rng, Ordinal count, std::span<uint> out) const;
+
             /*!
              * \brief Virtual destructor for UrnOR.
              * Virtual destructor to be a valid base class.
@@ -344,8 +1111,23 @@ namespace urn
             virtual ~UrnOR();
          
         protected:
+            /*!
+             * \brief Writes the draw of an ordinal number in range into draw for unrank().
+             * The digits of the ordinal number in base n are extracted with the power table, 
+             * so the calculation needs k integer divisions.
+             */
+            virtual void unrankDraw(Ordinal ordinalnumber, std::span<uint> draw) const;
+
+            /*!
+             * \brief Calculates the ordinal number of a draw for rank().
+             * Horner scheme in base n, O(k).
+             * \return Ordinal number of type Ordinal.
+             */
+            virtual Ordinal rankDraw(std::span<const uint> draw) const;
+
             const uint m_n, //!< The number of balls inside the urn.
                        m_k; //!< The size of a draw from the urn.
+            std::vector<Ordinal> m_powers;  //!< Powers n^0 to n^k, as far as they are representable by Ordinal (only n^0 for n < 2).
     };
 
     /*!
@@ -373,13 +1155,13 @@ namespace urn
              * \brief Getter method which returns z.
              * \return z the number of all possible draws.
              */
-            virtual uint z() const override;
+            virtual Ordinal z() const override;
 
             /*!
-             * \brief Calculates the corresponding draw from a given ordinal number.
-             * \return Draw of type Draw.
+             * \brief Indicates whether the urn model contains repetitions.
+             * \return false
              */
-            virtual Draw draw(uint ordinalnumber) const override;
+            virtual bool repetition() const override;
 
             /*!
              * \brief Specifies the subsequent draw for the specified draw, if it exists.
@@ -393,11 +1175,40 @@ namespace urn
              */
             virtual Draw backDraw(Draw draw) const override;
 
+            /*!
+             * \brief Replaces the given draw in place by its subsequent draw.
+             * Lexicographic next k-permutation, O(k) for n <= 64 and O(k + n/64) otherwise.
+             * \return true if there is a subsequent draw, otherwise false and the content of draw is unspecified.
+             */
+            virtual bool successor(std::span<uint> draw) const override;
+
+            /*!
+             * \brief Replaces the given draw in place by its previous draw.
+             * Lexicographic previous k-permutation with the same complexity as successor().
+             * \return true if there is a previous draw, otherwise false and the content of draw is unspecified.
+             */
+            virtual bool predecessor(std::span<uint> draw) const override;
+
             /*!
              * \brief Method to search for duplicate elements.
+             * All balls of repDraw must be smaller than n, which valid() ensures.
              * \return true/false depends if the draw is valid.
              */
-            bool repetitions(const Draw& repDraw) const;
+            bool repetitions(std::span<const uint> repDraw) const;
+
+        protected:
+            /*!
+             * \brief Writes the draw of an ordinal number in range into draw for unrank().
+             * Decodes the Lehmer code in place, O(k^2) without allocation.
+             */
+            virtual void unrankDraw(Ordinal ordinalnumber, std::span<uint> draw) const override;
+
+            /*!
+             * \brief Calculates the ordinal number of a draw for rank().
+             * Horner scheme over the Lehmer code, the used balls are counted by a Fenwick tree, O(k log k).
+             * \return Ordinal number of type Ordinal.
+             */
+            virtual Ordinal rankDraw(std::span<const uint> draw) const override;
     };
 
     /*!
@@ -426,13 +1237,13 @@ namespace urn
              * \brief Getter method which returns z.
              * \return z the number of all possible draws.
              */
-            virtual uint z() const override;
+            virtual Ordinal z() const override;
 
             /*!
-             * \brief Calculates the corresponding draw from a given ordinal number.
-             * \return Draw of type Draw.
+             * \brief Indicates whether the order of the balls is important for the urn model.
+             * \return false
              */
-            virtual Draw draw(uint ordinalnumber) const override;
+            virtual bool order() const override;
 
             /*!
              * \brief Specifies the subsequent draw for the specified draw, if it exists.
@@ -446,11 +1257,40 @@ namespace urn
              */
             virtual Draw backDraw(Draw draw) const override;
 
+            /*!
+             * \brief Replaces the given draw in place by its subsequent draw.
+             * Lexicographic next nondecreasing sequence, O(k).
+             * \return true if there is a subsequent draw, otherwise false and the content of draw is unspecified.
+             */
+            virtual bool successor(std::span<uint> draw) const override;
+
+            /*!
+             * \brief Replaces the given draw in place by its previous draw.
+             * Lexicographic previous nondecreasing sequence, O(k).
+             * \return true if there is a previous draw, otherwise false and the content of draw is unspecified.
+             */
+            virtual bool predecessor(std::span<uint> draw) const override;
+
             /*!
              * \brief Method to check if an element with a lower index value is greater than its neighbor element with index value plus one.
              * \return true/false depends if the draw is valid.
              */
-            bool unsorted(const Draw& unsortDraw) const;
+            bool unsorted(std::span<const uint> unsortDraw) const;
+
+        protected:
+            /*!
+             * \brief Writes the draw of an ordinal number in range into draw for unrank().
+             * Unranks the combination of k out of n+k-1 balls (stars and bars), O(n+k).
+             */
+            virtual void unrankDraw(Ordinal ordinalnumber, std::span<uint> draw) const override;
+
+            /*!
+             * \brief Calculates the ordinal number of a draw for rank().
+             * The draw is mapped to a combination of k out of n+k-1 balls (stars and bars),
+             * whose binomial coefficients are updated from position to position, O(k^2) in the worst case.
+             * \return Ordinal number of type Ordinal.
+             */
+            virtual Ordinal rankDraw(std::span<const uint> draw) const override;
     };
 
     /*!
@@ -476,13 +1316,19 @@ namespace urn
              * \brief Getter method which returns z.
              * \return z the number of all possible draws.
              */
-            virtual uint z() const override;
+            virtual Ordinal z() const override;
 
             /*!
-             * \brief Calculates the corresponding draw from a given ordinal number.
-             * \return Draw of type Draw.
+             * \brief Indicates whether the order of the balls is important for the urn model.
+             * \return false
              */
-            virtual Draw draw(uint ordinalnumber) const override;
+            virtual bool order() const override;
+
+            /*!
+             * \brief Indicates whether the urn model contains repetitions.
+             * \return false
+             */
+            virtual bool repetition() const override;
 
             /*!
              * \brief Specifies the subsequent draw for the specified draw, if it exists.
@@ -495,6 +1341,137 @@ namespace urn
              * \return Previous draw of type Draw.
              */
             virtual Draw backDraw(Draw draw) const override;
+
+            /*!
+             * \brief Replaces the given draw in place by its subsequent draw.
+             * Lexicographic next combination, O(k).
+             * \return true if there is a subsequent draw, otherwise false and the content of draw is unspecified.
+             */
+            virtual bool successor(std::span<uint> draw) const override;
+
+            /*!
+             * \brief Replaces the given draw in place by its previous draw.
+             * Lexicographic previous combination, O(k).
+             * \return true if there is a previous draw, otherwise false and the content of draw is unspecified.
+             */
+            virtual bool predecessor(std::span<uint> draw) const override;
+
+        protected:
+            /*!
+             * \brief Writes the draw of an ordinal number in range into draw for unrank().
+             * Combinatorial number system, O(n+k).
+             */
+            virtual void unrankDraw(Ordinal ordinalnumber, std::span<uint> draw) const override;
+
+            /*!
+             * \brief Calculates the ordinal number of a draw for rank().
+             * Combinatorial number system, the binomial coefficient is updated from position to position, O(k^2) in the worst case.
+             * \return Ordinal number of type Ordinal.
+             */
+            virtual Ordinal rankDraw(std::span<const uint> draw) const override;
+    };
+
+    /*!
+     * \struct Change
+     * \brief A position of a draw which was changed by a step of MinimalChange.
+     */
+    struct Change
+    {
+        uint position;      //!< Position of the draw which changed.
+        uint oldBall;       //!< Ball at the position before the step.
+        uint newBall;       //!< Ball at the position after the step.
+    };
+
+    /*!
+     * \class MinimalChange
+     * \brief Enumerates all draws of an urn in an order where a step changes at most two positions.
+     * UrnOR uses the reflected mixed-radix Gray code (one position per step).
+     * Urn uses the revolving door order, one ball leaves and one ball enters the draw (at most two positions of the sorted draw).
+     * UrnR uses the revolving door order of the corresponding combinations of n+k-1 balls (at most two positions).
+     * UrnO uses plain changes (Steinhaus-Johnson-Trotter, adjacent swaps) for the arrangements of a set of balls
+     * and the revolving door order to replace one ball of the set (one position).
+     * The order differs from the lexicographic order of the ordinal numbers.
+     * Every step is O(1) amortized, except the replacement of a ball for UrnO which is O(k) once per k! steps.
+     */
+    class MinimalChange
+    {
+        public:
+            /*!
+             * \brief Constructor for MinimalChange.
+             * The enumeration starts with the first draw of the urn. The urn is only read by the constructor.
+             * @param[in] urn   The urn whose draws are enumerated.
+             */
+            explicit MinimalChange(const UrnOR& urn);
+
+            /*!
+             * \brief Indicates whether the enumeration has a current draw.
+             * \return false if the urn has no draws or next() has returned false.
+             */
+            bool valid() const;
+
+            /*!
+             * \brief Getter method which returns the current draw.
+             * \return Returns a reference to the current draw, which is valid until the enumerator is changed.
+             */
+            const Draw& draw() const;
+
+            /*!
+             * \brief Advances to the next draw of the enumeration.
+             * \return true if there is a next draw, otherwise false and the current draw is no longer valid.
+             */
+            bool next();
+
+            /*!
+             * \brief Getter method which returns the changes of the last call of next().
+             * \return One or two changed positions with the old and the new ball, empty before the first step and at the end.
+             */
+            std::span<const Change> changes() const;
+
+        protected:
+            /*!
+             * \brief Step of the reflected mixed-radix Gray code (Knuth, Algorithm 7.2.1.1 H).
+             * \return true if there is a next draw.
+             */
+            bool nextGrayCode();
+
+            /*!
+             * \brief Step of the revolving door order (Knuth, Algorithm 7.2.1.3 R).
+             * Writes the changed positions of the combination into combinationChanges.
+             * \return Number of changed positions, 0 at the end.
+             */
+            uint nextCombination(std::array<Change, 2>& combinationChanges);
+
+            /*!
+             * \brief Step of the plain changes (Knuth, Algorithm 7.2.1.2 P) which swaps two adjacent positions of the draw.
+             * \return true if there is a next arrangement.
+             */
+            bool nextPlainChange();
+
+            /*!
+             * \brief Resets the plain changes so that the arrangements of the current draw are enumerated.
+             */
+            void resetPlainChange();
+
+            /*!
+             * \brief Sets a position of the current draw and records the change.
+             */
+            void record(uint position, uint newBall);
+
+            uint m_n;                                   //!< The number of balls inside the urn.
+            uint m_k;                                   //!< The size of a draw from the urn.
+            bool m_order;                               //!< Is order important?
+            bool m_repetition;                          //!< Is repetition important?
+            bool m_valid;                               //!< Indicates whether there is a current draw.
+            Draw m_draw;                                //!< The current draw.
+            std::array<Change, 2> m_changes;            //!< The changes of the last step.
+            uint m_changeCount;                         //!< The number of changes of the last step.
+            Draw m_digits;                              //!< Gray code: digits, digit j is position k-1-j of the draw.
+            std::vector<uint> m_focus;                  //!< Gray code: focus pointers.
+            std::vector<int> m_directions;              //!< Gray code: directions of the digits.
+            std::vector<uint> m_combination;            //!< Revolving door: c_1 < ... < c_t, 1-based with the sentinel c_(t+1).
+            uint m_combinationSize;                     //!< Revolving door: t, the size of the combination.
+            std::vector<int> m_plainOffsets;            //!< Plain changes: offsets c_j, 1-based.
+            std::vector<int> m_plainDirections;         //!< Plain changes: directions o_j, 1-based.
     };
 
     /*!
@@ -532,6 +1509,22 @@ namespace urn
     template <>
     struct UrnSelector<false, false>;
 
+    /*!
+     * \class StaticUrn - compile-time counterpart of GenericUrn/UrnSelector for fixed n and k.
+     * All member functions are static and constexpr, so the number of draws, draws, ordinal numbers and 
+     * successors can be calculated at compile time, e.g. to bake a table of all draws into the binary with allDraws().
+     * A draw is a std::array of K balls of type std::uint8_t for N <= 256, otherwise std::uint16_t.
+     * The draws are in the same order as in the corresponding urn UrnOR, UrnO, UrnR or Urn.
+     * Invalid arguments throw the same exceptions as the urns, which is a compile error in a constant expression.
+     * 
+     * @tparam N            The number of balls inside the urn, at most 65536.
+     * @tparam K            The size of a draw from the urn.
+     * @tparam ORDER        Is order important?
+     * @tparam REPETITION   Is repetition important?      
+     */
+    template<uint N, uint K, bool ORDER = true, bool REPETITION = true>
+    class StaticUrn;
+
     /*!
      * \class GenericUrn - Template-Wrapper for the urn models/draw-generator.
      * 
@@ -549,16 +1542,20 @@ namespace urn
              * \brief Iterator which fulfills the requirements as a random access iterator.
              * The behavior is based on the std::vector class. 
              * The special feature of the iterator is that it does not use a memory structure like a vector.
+             * The iterator keeps the current draw as ball indices. Incrementing and decrementing replace it in place 
+             * by its successor or predecessor, so a walk over the urn does not calculate every draw from its ordinal number.
+             * Jumps calculate the draw from the new ordinal number. The elements are only copied by operator*. A const iterator is never changed, so several threads can dereference it.
              */
             class Iterator 
             {
                 public:
-                    using iterator_category = std::random_access_iterator_tag;  /*!< Using decleration for the iterator category which is std::random_access_iterator.*/
-                    using difference_type   = std::ptrdiff_t;                   /*!< Using decleration for the difference type which is ptrdiff_t.*/
+                    using iterator_category = std::random_access_iterator_tag;  /*!< Using decleration for the iterator category which is std::random_access_iterator, so that the classic and the parallel algorithms jump in O(1).*/
+                    using iterator_concept  = std::random_access_iterator_tag;  /*!< Using decleration for the C++20 iterator concept, so that std::ranges and the parallel algorithms treat the iterator as random access iterator.*/
+                    using difference_type   = SignedOrdinal;                    /*!< Using decleration for the difference type which is SignedOrdinal.*/
                     using value_type        = std::vector<T>;                   /*!< Using decleration for the value type which is vector<T>.*/
                     using pointer           = std::vector<T>*;                  /*!< Using decleration for the pointer which is vector<T>*.*/
-                    using reference         = const std::vector<T>;             /*!< Using decleration for the reference. The type is const vector<T> due to an error in the standard library when using the std::make_reverse_iterator (http://gcc.gnu.org/PR51823).*/
-                    using size_type         = std::size_t;                      /*!< Using decleration for the size type which is size_t.*/
+                    using reference         = std::vector<T>;                   /*!< Using decleration for the reference, the draw is returned by value, because the iterator keeps it itself.*/
+                    using size_type         = Ordinal;                          /*!< Using decleration for the size type which is Ordinal.*/
 
                     /*!
                      * \enum enum class Status
@@ -578,7 +1575,7 @@ namespace urn
                      * @param[in] ordinalnumber     Indicates the ordinal number of a draw.
                      * @param[in] check             Indicates the status of the iterator.
                      */
-                    Iterator(const GenericUrn<T, ORDER, REPETITION>* urn, const uint& ordinalnumber, const Status& status);
+                    Iterator(const GenericUrn<T, ORDER, REPETITION>* urn, const Ordinal& ordinalnumber, const Status& status);
 
                     /*!
                      * \brief Standard constructor for Iterator.
@@ -608,20 +1605,20 @@ namespace urn
                      * \brief Getter method which returns z.
                      * \return z the number of all possible draws.
                      */
-                    uint z() const;
+                    Ordinal z() const;
 
                     /*!
                      * \brief Getter method which returns ordinalnumber.
                      * \return ordinalnumber the ordinal number of the current draw.
                      */
-                    int ordinalnumber() const;
+                    SignedOrdinal ordinalnumber() const;
                     
                     /*!
                      * \brief Operator for pointer dereferencing. 
-                     * \return Returns the current draw of the iterator as value type.
-                     * If the iterator is outside the range, a vector filled with zeros is returned. 
+                     * \return Returns the elements of the current draw of the iterator, which are copied on every call.
+                     * If the iterator is outside the range, an std::domain_error is thrown. 
                      */
-                    const value_type operator*() const;
+                    reference operator*() const;
 
                     /*!
                      * \brief Operator for pre-incrementation. 
@@ -723,11 +1720,36 @@ namespace urn
                      */
                     difference_type operator-(const Iterator& other) const;
 
+                    /*!
+                     * \brief Operator for equal to comparison with the end of the urn.
+                     * \return Returns true if the iterator is at or after the end of the urn.
+                     */
+                    bool operator== (std::default_sentinel_t) const;
+
+                    /*!
+                     * \brief Operator for distance to the end of the urn.
+                     * \return Returns the number of draws from the iterator to the end of the urn.
+                     */
+                    friend difference_type operator-(std::default_sentinel_t, const Iterator& other)
+                    {
+                        return static_cast<difference_type>(other.m_z) - other.m_ordinalnumber;
+                    }
+
+                    /*!
+                     * \brief Operator for distance from the end of the urn.
+                     * \return Returns the negative number of draws from the iterator to the end of the urn.
+                     */
+                    friend difference_type operator-(const Iterator& other, std::default_sentinel_t)
+                    {
+                        return other.m_ordinalnumber - static_cast<difference_type>(other.m_z);
+                    }
+
                     /*!
                      * \brief Operator for index. 
-                     * \return Returns the draw to the given index.
+                     * \return Returns a copy of the draw n positions after the current draw, like *(*this + n).
+                     * If the index is outside the range, an std::domain_error is thrown. 
                      */
-                    reference operator[](size_type index) const;
+                    value_type operator[](const difference_type& n) const;
 
                     /*!
                      * \brief Destructor for Iterator.
@@ -736,9 +1758,27 @@ namespace urn
                     ~Iterator();
 
                 protected:
+                    /*!
+                     * \brief Checks whether the ordinal number of the iterator belongs to a draw.
+                     * \return true/false depends if the ordinal number is in the range from 0 to z-1.
+                     */
+                    bool inRange() const;
+
+                    /*!
+                     * \brief Sets the status according to the ordinal number.
+                     */
+                    void updateStatus();
+
+                    /*!
+                     * \brief Calculates the current draw from the ordinal number, which must be in range.
+                     */
+                    void load();
+
                     const GenericUrn<T, ORDER, REPETITION>* m_itUrn;    //!< Pointer to an urn on which the various functions are executed.
-                    int m_ordinalnumber;                                //!< Indicates the ordinal number of a draw.
+                    SignedOrdinal m_ordinalnumber;                      //!< Indicates the ordinal number of a draw.
                     Status m_status;                                    //!< Indicates the status of the iterator
+                    Ordinal m_z {};                                     //!< The number of all possible draws of the urn, kept to avoid calls of z().
+                    Draw m_draw;                                        //!< The current draw of the iterator, which belongs to the ordinal number inside the range.
             };
 
         public:
@@ -772,31 +1812,47 @@ namespace urn
              * \brief Getter method which returns z.
              * \return z the number of all possible draws.
              */
-            uint z() const;
+            Ordinal z() const;
 
             /*!
              * \brief Begin iterator.
              * \return Returns an iterator pointing to the first element in the sequence.
              */
-            Iterator begin();
+            Iterator begin() const;
+
+            /*!
+             * \brief Begin iterator at a given draw.
+             * \return Returns an iterator pointing to the given draw.
+             */
+            Iterator begin(const std::vector<T>& draw) const;
 
             /*!
              * \brief End iterator.
              * \return Returns an iterator to the end (i.e. the element after the last element) of the given range.
              */
-            Iterator end();
+            Iterator end() const;
 
             /*!
              * \brief Reverse begin iterator.
              * \return Returns an iterator to the reverse-beginning of the given range.
              */
-            std::reverse_iterator<GenericUrn<T,ORDER,REPETITION>::Iterator> rbegin();
+            ReverseIterator<GenericUrn<T,ORDER,REPETITION>::Iterator> rbegin() const;
 
             /*!
              * \brief Reverse begin iterator.
              * \return Returns an iterator to the reverse-end of the given range.
              */
-            std::reverse_iterator<GenericUrn<T,ORDER,REPETITION>::Iterator> rend();
+            ReverseIterator<GenericUrn<T,ORDER,REPETITION>::Iterator> rend() const;
+
+            /*!
+             * \brief Shard of the draws, used to split an enumeration across threads, processes or machines.
+             * The ordinal numbers 0 to z-1 are split into m contiguous shards whose sizes differ by at most one.
+             * If i >= m, an std::domain_error is thrown.
+             * @param[in] i  The index of the shard from 0 to m-1.
+             * @param[in] m  The number of shards.
+             * \return Returns the sized range of the draws of shard i.
+             */
+            std::ranges::subrange<Iterator> shard(const Ordinal& i, const Ordinal& m) const;
 
             /*!
              * \brief Converts the draw of type vector<uint> to the elements of type vector<T>. 
@@ -804,11 +1860,25 @@ namespace urn
              */
             std::vector<T> to_element(const Draw& draw) const;
 
+            /*!
+             * \brief Converts the elements of type vector<T> to the draw of type vector<uint>, the inverse of to_element(). 
+             * If T is totally ordered, every element is found by a binary search in O(log n), otherwise by a linear search in O(n).
+             * \return Returns the draw of type Draw.
+             */
+            Draw to_draw(const std::vector<T>& draw) const;
+
             /*!
              * \brief Specifies the subsequent draw for the specified draw, if it exists.
              * \return Next draw of type vector<T>.
              */
-            auto draw(uint ordinalnumber) const;
+            auto draw(Ordinal ordinalnumber) const;
+
+            /*!
+             * \brief Calculates the elements of the draw with the given ordinal number without an allocation for k <= URN_SMALL_DRAW_CAPACITY.
+             * Only available for trivially copyable element types.
+             * \return Draw of type BasicSmallDraw<T, URN_SMALL_DRAW_CAPACITY>.
+             */
+            BasicSmallDraw<T, URN_SMALL_DRAW_CAPACITY> smallDraw(Ordinal ordinalnumber) const requires std::is_trivially_copyable_v<T>;
 
             /*!
              * \brief Specifies the previous draw for the specified draw, if it exists.
@@ -834,15 +1904,44 @@ namespace urn
              */
             auto lastDraw();
 
+            /*!
+             * \brief Calculates the ordinal number of a given draw, the inverse of draw().
+             * The elements are converted with to_draw(), in O(k log n) if T is totally ordered.
+             * \return Ordinal number of type Ordinal.
+             */
+            Ordinal rank(const std::vector<T>& draw) const;
+
+            /*!
+             * \brief Writes count consecutive draws of elements, starting with the draw of the ordinal number first, into out.
+             * Works like UrnOR::fill(). out must provide count*k elements.
+             */
+            void fill(Ordinal first, Ordinal count, std::span<T> out, Layout layout = Layout::rowMajor) const;
+
+            /*!
+             * \brief Returns a uniformly distributed random draw of elements.
+             * Works like UrnOR::sample().
+             * \return Random draw of type vector<T>.
+             */
+            template<class RNG>
+            std::vector<T> sample(RNG& rng) const;
+
+            /*!
+             * \brief Writes count independent, uniformly distributed random draws of elements one after another into out.
+             * Works like UrnOR::sample_n(). out must provide count*k elements.
+             */
+            template<class RNG>
+            void sample_n(RNG& rng, Ordinal count, std::span<T> out) const;
+
         private:
             using UrnType = typename UrnSelector<ORDER,REPETITION>::UrnType;    /*!< Using decleration as alias for the urn types. */
             UrnType m_urn;                                                      /*!< Exampler of an urn of type UrnType. */
             std::vector<T> m_elements;                                          /*!< Vector of type T containing the different elements inside the urn. */
+            std::vector<uint> m_sortedIndices;                                  /*!< Indices of m_elements sorted by their elements for to_draw(), empty if T is not totally ordered. */
     };
 
     /*!
      * Include guard for definitions.tpp
-     * definitions.tpp contains the definitions of the class/function templates
+     * definitions.tpp contains the definitions of the class/function templates and of the constexpr helper functions
      */
     #if __has_include("definitions.tpp")
     #include "definitions.tpp"